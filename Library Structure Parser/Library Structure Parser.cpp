@@ -18,19 +18,19 @@ public:
 private:
     /* Self Properties */
     Type ItemType;
-    std::wstring Name; /* Item name */
+    NosStdLib::String::InternedString<wchar_t> Name; /* Item name (interned, the same names show up across lots of headers) */
 
     /* Item Relation ships */
-    NosStdLib::DynamicArray<Item*> Children; /* Array Pointer of children */
+    NosStdLib::SmallDynamicArray<Item*, 4> Children; /* Array Pointer of children (most items only have a few, so they are stored inline) */
     Item* Parent; /* Pointer to parent */
 public:
     /* Tracking Properties */
     int BracketCloseCount;
 
-    Item(Type type, std::wstring name, Item* parent)
+    Item(Type type, std::wstring_view name, Item* parent)
     {
         ItemType = type;
-        Name = name;
+        Name = NosStdLib::String::Interner<wchar_t>::GetGlobal().Intern(name);
         Parent = parent;
     }
 
@@ -39,7 +39,7 @@ public:
         return Parent;
     }
 
-    std::wstring GetName()
+    NosStdLib::String::InternedString<wchar_t> GetName()
     {
         return Name;
     }
@@ -50,6 +50,21 @@ public:
     }
 };
 
+/// <summary>
+/// Finds the word after a keyword in a line (e.g. the name after "class"). indexes the line once with string views, no copy per word
+/// </summary>
+/// <param name="line">- line to look through</param>
+/// <param name="keyword">- the keyword</param>
+/// <returns>the word after the keyword (empty if there isn't one)</returns>
+std::wstring_view WordAfter(std::wstring_view line, std::wstring_view keyword)
+{
+    NosStdLib::String::WordIndex<wchar_t> words(line, L" \t"); /* indentation is tabs */
+    size_t keywordIndex = words.Find(keyword);
+    if (keywordIndex == std::wstring_view::npos || keywordIndex + 1 >= words.GetWordCount())
+        return {};
+    return words[keywordIndex + 1];
+}
+
 /// <summary>
 /// Parse a specified header to get the library structer
 /// </summary>
@@ -61,22 +76,24 @@ void ParseHeader(const std::wstring& filePath)
     Item* currentItem = new Item(Item::Type::Namespace, L"Root", nullptr);
     while (std::getline(ParserStream, line)) /* iterate over each line in the header file */
     {
-        if (size_t point = line.find(L"namespace") != std::string::npos)
+        if (line.find(L"namespace") != std::string::npos)
         {
-            wprintf((L"namespace " + NosStdLib::String::FindNthWord<wchar_t>(line, point, 2, L' ') + L"\n").c_str());
+            std::wstring_view namespaceName = WordAfter(line, L"namespace");
+            wprintf(L"namespace %.*ls\n", (int)namespaceName.size(), namespaceName.data());
 
-            Item *namespaceItem = new Item(Item::Type::Namespace, NosStdLib::String::FindNthWord<wchar_t>(line, point, 2, L' '), currentItem);
+            Item *namespaceItem = new Item(Item::Type::Namespace, namespaceName, currentItem);
 
             if (currentItem != nullptr)
                 currentItem->AddChild(namespaceItem);
 
             currentItem = namespaceItem;
         }
-        else if (size_t point = line.find(L"class") != std::string::npos)
+        else if (line.find(L"class") != std::string::npos)
         {
-            wprintf((L"class " + NosStdLib::String::FindNthWord<wchar_t>(line, point, 2, L' ') + L"\n").c_str());
+            std::wstring_view className = WordAfter(line, L"class");
+            wprintf(L"class %.*ls\n", (int)className.size(), className.data());
 
-            Item *classItem = new Item(Item::Type::Class, NosStdLib::String::FindNthWord<wchar_t>(line, point, 2, L' '), currentItem);
+            Item *classItem = new Item(Item::Type::Class, className, currentItem);
 
             if (currentItem != nullptr)
                 currentItem->AddChild(classItem);
@@ -157,4 +157,681 @@ LC.StartLoading(&LongFunctionTing, &SomeVar);
 
 wprintf(L"Press any button to continue"); _getch();
 NosStdLib::LoadingScreen::TerminateFont();
-*/
\ No newline at end of file
+*/
+
+/* DYNAMIC ARRAY GROWTH BENCHMARK
+#include <NosStdLib/DynamicArray.hpp>
+#include <chrono>
+
+====MAIN====
+for (NosStdLib::ResizeMode mode : { NosStdLib::StepMode, NosStdLib::OneAndHalfMode, NosStdLib::DoubleMode })
+{
+    for (int count = 1000000; count <= 100000000; count *= 10)
+    {
+        if (mode == NosStdLib::StepMode && count > 1000000) // step mode is O(N^2), so only run the smallest size
+            break;
+
+        NosStdLib::DynamicArray<int> array(10, 10, mode);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+            array.Append(i);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::wcout << L"Mode: " << (int)mode << L" | Count: " << count << L" | Total: " << seconds << L"s | Per Append: " << (seconds / count) * 1e9 << L"ns" << std::endl;
+    }
+}
+*/
+
+/* DYNAMIC ARRAY MULTIAPPEND BENCHMARK
+#include <NosStdLib/DynamicArray.hpp>
+#include <chrono>
+#include <vector>
+
+====MAIN====
+std::vector<int> source(1000000, 7);
+
+std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+NosStdLib::DynamicArray<int> loopArray;
+for (int value : source)
+    loopArray.Append(value);
+double loopSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+start = std::chrono::steady_clock::now();
+NosStdLib::DynamicArray<int> rangeArray;
+rangeArray.MultiAppend(source.data(), (int)source.size());
+double rangeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+std::wcout << L"Append loop: " << loopSeconds << L"s | MultiAppend: " << rangeSeconds << L"s" << std::endl;
+*/
+
+/* SMALL DYNAMIC ARRAY TREE BENCHMARK
+#include <NosStdLib/DynamicArray.hpp>
+#include <chrono>
+
+struct HeapNode { NosStdLib::DynamicArray<HeapNode*> Children; };
+struct InlineNode { NosStdLib::SmallDynamicArray<InlineNode*, 4> Children; };
+
+template<class NodeType>
+double BuildTree(int nodeCount)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    NodeType* nodes = new NodeType[nodeCount];
+    for (int i = 1; i < nodeCount; i++) // every node gets up to 3 children
+        nodes[(i - 1) / 3].Children.Append(&nodes[i]);
+
+    long long childTotal = 0;
+    for (int i = 0; i < nodeCount; i++)
+        for (NodeType* child : nodes[i].Children)
+            childTotal += (child != nullptr);
+
+    delete[] nodes;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+====MAIN====
+std::wcout << L"DynamicArray children: " << BuildTree<HeapNode>(1000000) << L"s" << std::endl;
+std::wcout << L"SmallDynamicArray children: " << BuildTree<InlineNode>(1000000) << L"s" << std::endl;
+*/
+
+/* DYNAMIC ARRAY ARENA TEST
+#include <NosStdLib/DynamicArray.hpp>
+#include <NosStdLib/Memory.hpp>
+
+====MAIN====
+NosStdLib::Memory::ArenaResource frameArena;
+for (int frame = 0; frame < 5; frame++)
+{
+    {
+        NosStdLib::PmrDynamicArray<int> values(&frameArena);
+        for (int i = 0; i < 100000; i++)
+            values.Append(i);
+        std::wcout << L"Frame " << frame << L" | Arena bytes: " << frameArena.GetBytesAllocated() << std::endl;
+    }
+    frameArena.Reset(); // frees every array of the frame at once
+}
+*/
+
+/* DYNAMIC ARRAY ALLOCATION COUNT TEST
+#include <NosStdLib/DynamicArray.hpp>
+#include <NosStdLib/Memory.hpp>
+
+====MAIN====
+NosStdLib::Memory::CountingResource counter;
+{
+    NosStdLib::PmrDynamicArray<std::wstring> lines(10, 0, NosStdLib::DoubleMode, &counter);
+    for (int cycle = 0; cycle < 100; cycle++)
+    {
+        size_t allocationsBefore = counter.GetAllocationCount();
+        for (int i = 0; i < 1000; i++)
+            lines.Append(L"line");
+        lines.Clear();
+
+        if (cycle > 0 && counter.GetAllocationCount() != allocationsBefore) // after the first cycle, Clear keeps the size so nothing should allocate
+            std::wcout << L"FAIL: cycle " << cycle << L" allocated " << counter.GetAllocationCount() - allocationsBefore << L" times" << std::endl;
+    }
+
+    lines.Reset();
+    std::wcout << L"After Reset | Array Size: " << lines.GetArraySize() << L" | Bytes in use: " << counter.GetBytesInUse() << std::endl;
+}
+std::wcout << L"Allocations: " << counter.GetAllocationCount() << L" | Deallocations: " << counter.GetDeallocationCount() << L" | Leaked bytes: " << counter.GetBytesInUse() << std::endl;
+*/
+
+/* DYNAMIC ARRAY SIMD BENCHMARK
+#include <NosStdLib/DynamicArray.hpp>
+#include <chrono>
+
+====MAIN====
+for (int size : {1000000, 10000000, 100000000})
+{
+    NosStdLib::DynamicArray<int> values(size, 0);
+    for (int i = 0; i < size; i++)
+        values.Append(i % 1000);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    long long simdSum = values.Sum();
+    int simdCount = values.Count(999);
+    int simdFind = values.Find(-1);
+    std::chrono::duration<double> simdTime = std::chrono::high_resolution_clock::now() - start;
+
+    start = std::chrono::high_resolution_clock::now();
+    long long scalarSum = 0;
+    int scalarCount = 0, scalarFind = -1;
+    for (int i = 0; i < size; i++)
+        scalarSum += values[i];
+    for (int i = 0; i < size; i++)
+        scalarCount += (values[i] == 999);
+    for (int i = 0; i < size; i++)
+        if (values[i] == -1) { scalarFind = i; break; }
+    std::chrono::duration<double> scalarTime = std::chrono::high_resolution_clock::now() - start;
+
+    double gigabytes = 3.0 * size * sizeof(int) / 1e9; // 3 passes over the array
+    std::wcout << size << L" | SIMD: " << gigabytes / simdTime.count() << L" GB/s | Scalar: " << gigabytes / scalarTime.count() << L" GB/s"
+               << ((simdSum == scalarSum && simdCount == scalarCount && simdFind == scalarFind) ? L"" : L" | RESULTS DIFFER") << std::endl;
+}
+*/
+
+/* DYNAMIC ARRAY PARALLEL SORT BENCHMARK
+#include <NosStdLib/DynamicArray.hpp>
+#include <chrono>
+#include <random>
+
+====MAIN====
+std::mt19937 generator(1);
+for (int size : {1000000, 10000000, 50000000})
+{
+    NosStdLib::DynamicArray<int> sequential(size, 0);
+    for (int i = 0; i < size; i++)
+        sequential.Append(generator());
+    NosStdLib::DynamicArray<int> parallel = sequential;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    sequential.Sort();
+    std::chrono::duration<double> sequentialTime = std::chrono::high_resolution_clock::now() - start;
+
+    start = std::chrono::high_resolution_clock::now();
+    parallel.Sort(NosStdLib::Parallel);
+    std::chrono::duration<double> parallelTime = std::chrono::high_resolution_clock::now() - start;
+
+    std::wcout << size << L" | Sequential: " << sequentialTime.count() << L"s | Parallel: " << parallelTime.count() << L"s | Speedup: " << sequentialTime.count() / parallelTime.count()
+               << L"x on " << NosStdLib::Threading::ThreadPool::GetGlobal().GetThreadCount() << L" threads" << std::endl;
+}
+*/
+
+/* CONCURRENT DYNAMIC ARRAY CONTENTION BENCHMARK
+#include <NosStdLib/DynamicArray.hpp>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+====MAIN====
+const int appendsPerThread = 1000000;
+for (int threadCount : {1, 2, 4, 8, 16, 32, 64})
+{
+    NosStdLib::DynamicArray<int> lockedArray(1024, 0, NosStdLib::DoubleMode);
+    std::mutex arrayMutex;
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back([&] { for (int i = 0; i < appendsPerThread; i++) { std::lock_guard<std::mutex> lock(arrayMutex); lockedArray.Append(i); } });
+    for (std::thread& thread : threads)
+        thread.join();
+    std::chrono::duration<double> lockedTime = std::chrono::high_resolution_clock::now() - start;
+
+    NosStdLib::ConcurrentDynamicArray<int> concurrentArray;
+    threads.clear();
+    start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back([&] { for (int i = 0; i < appendsPerThread; i++) concurrentArray.Append(i); });
+    for (std::thread& thread : threads)
+        thread.join();
+    std::chrono::duration<double> concurrentTime = std::chrono::high_resolution_clock::now() - start;
+
+    double totalAppends = (double)threadCount * appendsPerThread / 1e6;
+    std::wcout << threadCount << L" threads | Mutex: " << totalAppends / lockedTime.count() << L" M appends/s | Concurrent: " << totalAppends / concurrentTime.count() << L" M appends/s" << std::endl;
+}
+*/
+
+/* CONCURRENT DYNAMIC ARRAY THROWING CONSTRUCTOR TEST
+#include <NosStdLib/DynamicArray.hpp>
+#include <stdexcept>
+
+====MAIN====
+struct Checked
+{
+    int Value;
+    Checked(int value) : Value(value) { if (value < 0) throw std::invalid_argument("negative value"); }
+};
+
+NosStdLib::ConcurrentDynamicArray<Checked> checkedArray;
+checkedArray.EmplaceAppend(0);
+try
+{
+    checkedArray.EmplaceAppend(-1); // index 1 stays empty
+}
+catch (const std::invalid_argument&) {}
+for (int i = 1; i <= 98; i++)
+    checkedArray.EmplaceAppend(i);
+
+NosStdLib::ConcurrentDynamicArray<Checked>::Snapshot snapshot = checkedArray.GetSnapshot();
+int objectCount = 0, valueSum = 0;
+for (const Checked& object : snapshot) // skips the empty index
+{
+    objectCount++;
+    valueSum += object.Value;
+}
+std::wcout << L"Indexes: " << snapshot.GetArrayIndexPointer() << L" (expected 100) | Objects: " << objectCount << L" (expected 99) | Sum: " << valueSum << L" (expected 4851) | Index 1 constructed: " << checkedArray.IsConstructed(1) << std::endl;
+*/
+
+/* STABLE DYNAMIC ARRAY TEST
+#include <NosStdLib/DynamicArray.hpp>
+
+====MAIN====
+NosStdLib::StableDynamicArray<std::wstring> lines;
+std::wstring* firstLine = &lines.EmplaceAppend(L"first line");
+for (int i = 0; i < 1000000; i++)
+    lines.Append(L"line");
+std::wcout << *firstLine << L" | Objects: " << lines.GetArrayIndexPointer() << L" | Chunks: " << lines.GetChunkCount() << std::endl; // firstLine never moved
+*/
+
+/* RING DYNAMIC ARRAY LOG TAIL TEST
+#include <NosStdLib/DynamicArray.hpp>
+
+====MAIN====
+NosStdLib::RingDynamicArray<std::wstring> logTail(5);
+for (int i = 0; i < 1000000; i++)
+    logTail.Append(L"log line " + std::to_wstring(i));
+
+for (const std::wstring& line : logTail) // only the last 5 lines, memory never grew
+    std::wcout << line << std::endl;
+std::wcout << L"First span: " << logTail.GetFirstSpan().size() << L" | Second span: " << logTail.GetSecondSpan().size() << std::endl;
+*/
+
+/* DYNAMIC ARRAY STATISTICS TEST
+#define NOSSTDLIB_DYNAMICARRAY_STATISTICS
+#include <NosStdLib/DynamicArray.hpp>
+
+====MAIN====
+{
+    NosStdLib::DynamicArray<int> stepArray;
+    stepArray.SetStatisticsName("StepMode 10/10");
+    NosStdLib::DynamicArray<int> doubleArray(10, 0, NosStdLib::DoubleMode);
+    doubleArray.SetStatisticsName("DoubleMode 10");
+    for (int i = 0; i < 100000; i++)
+    {
+        stepArray.Append(i);
+        doubleArray.Append(i);
+    }
+    NosStdLib::DynamicArrayStatisticsRegistry::GetRegistry().DumpTable();
+}
+NosStdLib::DynamicArrayStatisticsRegistry::GetRegistry().DumpTable(); // both arrays are destroyed now, their statistics stay
+*/
+
+/* STRING PARSE INTEGER BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+#include <random>
+#include <vector>
+
+====MAIN====
+std::mt19937 generator(1);
+std::vector<std::wstring> numbers;
+for (int i = 0; i < 1000000; i++)
+    numbers.push_back(std::to_wstring((int)generator()));
+size_t totalCharacters = 0;
+for (const std::wstring& number : numbers)
+    totalCharacters += number.size();
+
+long long parseSum = 0, stoiSum = 0;
+auto start = std::chrono::high_resolution_clock::now();
+for (const std::wstring& number : numbers)
+{
+    int value = 0;
+    NosStdLib::String::ParseInteger(number, value);
+    parseSum += value;
+}
+std::chrono::duration<double> parseTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+for (const std::wstring& number : numbers)
+    stoiSum += std::stoi(number);
+std::chrono::duration<double> stoiTime = std::chrono::high_resolution_clock::now() - start;
+
+std::wcout << L"ParseInteger: " << totalCharacters / parseTime.count() / 1e6 << L" M chars/s | std::stoi: " << totalCharacters / stoiTime.count() / 1e6 << L" M chars/s"
+           << (parseSum == stoiSum ? L"" : L" | RESULTS DIFFER") << std::endl;
+
+std::wstring longNumber(10000000, L'7');
+start = std::chrono::high_resolution_clock::now();
+bool isNumber = NosStdLib::String::IsNumber(longNumber);
+std::chrono::duration<double> isNumberTime = std::chrono::high_resolution_clock::now() - start;
+std::wcout << L"IsNumber (10M chars): " << isNumber << L" | " << longNumber.size() / isNumberTime.count() / 1e9 << L" G chars/s" << std::endl;
+*/
+
+/* STRING SPLITVIEW BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+
+====MAIN====
+std::wstring text;
+for (int i = 0; i < 2000000; i++)
+    text += L"token" + std::to_wstring(i % 1000) + (i % 7 == 0 ? L"\n" : L" ");
+
+auto start = std::chrono::high_resolution_clock::now();
+std::vector<std::wstring> splitTokens;
+NosStdLib::String::Split<wchar_t>(&splitTokens, &text, L' ');
+std::chrono::duration<double> splitTime = std::chrono::high_resolution_clock::now() - start;
+
+size_t viewCount = 0, viewCharacters = 0;
+start = std::chrono::high_resolution_clock::now();
+for (std::wstring_view token : NosStdLib::String::SplitView(text, L' '))
+{
+    viewCount++;
+    viewCharacters += token.size();
+}
+std::chrono::duration<double> viewTime = std::chrono::high_resolution_clock::now() - start;
+
+std::wcout << L"Split: " << splitTime.count() * 1000 << L"ms (" << splitTokens.size() << L" tokens) | SplitView: " << viewTime.count() * 1000 << L"ms (" << viewCount << L" tokens)" << std::endl;
+*/
+
+/* STRING CONVERSION BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+
+====MAIN====
+// scalar reference: 1 code point at a time, no ASCII fast path and no size precomputation
+auto scalarToWstring = [](const std::string& input)
+{
+    std::wstring output;
+    const char* current = input.data();
+    const char* last = input.data() + input.size();
+    while (current != last)
+    {
+        char32_t codePoint;
+        if (!NosStdLib::String::Kernels::DecodeCodePoint(current, last, codePoint))
+            codePoint = NosStdLib::String::ReplacementCharacter;
+        wchar_t buffer[2];
+        wchar_t* end = buffer;
+        NosStdLib::String::Kernels::EncodeCodePoint(end, codePoint);
+        output.append(buffer, end);
+    }
+    return output;
+};
+
+std::string asciiText, mixedText;
+for (int i = 0; i < 1000000; i++)
+{
+    asciiText += "plain ascii text ";
+    mixedText += (i % 4 == 0 ? "\xE2\x94\x80\xE2\x96\x88 " : "text ");
+}
+
+for (const std::string* text : { &asciiText, &mixedText })
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    std::wstring converted = NosStdLib::String::ToWstring(*text);
+    std::chrono::duration<double> convertTime = std::chrono::high_resolution_clock::now() - start;
+
+    start = std::chrono::high_resolution_clock::now();
+    std::wstring reference = scalarToWstring(*text);
+    std::chrono::duration<double> referenceTime = std::chrono::high_resolution_clock::now() - start;
+
+    std::wcout << (text == &asciiText ? L"ascii" : L"mixed") << L" UTF-8 -> wstring: " << text->size() / convertTime.count() / 1e6 << L" MB/s | scalar: "
+               << text->size() / referenceTime.count() / 1e6 << L" MB/s" << (converted == reference ? L"" : L" | RESULTS DIFFER") << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    std::string back = NosStdLib::String::ToString(converted);
+    std::chrono::duration<double> backTime = std::chrono::high_resolution_clock::now() - start;
+    std::wcout << L"    wstring -> UTF-8: " << text->size() / backTime.count() / 1e6 << L" MB/s" << (back == *text ? L"" : L" | ROUND TRIP FAILED") << std::endl;
+}
+*/
+
+/* STRING DISPLAY WIDTH CENTER TEST
+#include <NosStdLib/String.hpp>
+#include <NosStdLib/Global.hpp>
+#include <NosStdLib/TextColor.hpp>
+#include <chrono>
+
+====MAIN====
+NosStdLib::Global::Console::InitializeModifiers::EnableUnicode();
+NosStdLib::Global::Console::InitializeModifiers::EnableANSI();
+
+// every line should line up in the middle, colors and wide characters included
+std::wstring lines = NosStdLib::TextColor::NosRGB(212, 155, 55).MakeANSICode<wchar_t>() + L">> Colored Entry <<\033[0m\n"
+                   + L">> Colored Entry <<\n"
+                   + L"日本語のテキスト\n"
+                   + L"██▌ blocks ▐██";
+wprintf(NosStdLib::String::CenterString(lines).c_str());
+
+int columns = NosStdLib::Global::Console::GetConsoleSize().Columns;
+auto start = std::chrono::high_resolution_clock::now();
+size_t totalSize = 0;
+for (int i = 0; i < 100000; i++)
+    totalSize += NosStdLib::String::CenterString(lines, columns, true).size();
+std::chrono::duration<double> centerTime = std::chrono::high_resolution_clock::now() - start;
+wprintf(L"CenterString with known columns: %f us per 4 line frame (%zu)\n", centerTime.count() * 10, totalSize);
+*/
+
+/* STRING WORD INDEX BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+
+====MAIN====
+std::wstring line;
+for (int i = 0; i < 2000; i++)
+    line += L"word" + std::to_wstring(i) + L' ';
+
+// every word by index: FindNthWord rescans from the start each time, WordIndex scans once
+auto start = std::chrono::high_resolution_clock::now();
+size_t nthCharacters = 0;
+for (int i = 0; i < 2000; i++)
+    nthCharacters += NosStdLib::String::FindNthWord<wchar_t>(line, 0, i).size();
+std::chrono::duration<double> nthTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+size_t indexCharacters = 0;
+NosStdLib::String::WordIndex<wchar_t> words(line);
+for (size_t i = 0; i < words.GetWordCount(); i++)
+    indexCharacters += words[i].size();
+std::chrono::duration<double> indexTime = std::chrono::high_resolution_clock::now() - start;
+
+std::wcout << L"FindNthWord: " << nthTime.count() * 1000 << L"ms | WordIndex: " << indexTime.count() * 1000 << L"ms"
+           << (nthCharacters == indexCharacters ? L"" : L" | RESULTS DIFFER") << std::endl;
+*/
+
+/* STRING BUILDER FRAME ALLOCATIONS BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <cstdlib>
+#include <new>
+
+static size_t AllocationCount = 0;
+void* operator new(size_t size)
+{
+    AllocationCount++;
+    if (void* memory = std::malloc(size))
+        return memory;
+    throw std::bad_alloc();
+}
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+
+====MAIN====
+// a menu frame: 20 centered entries with values and a status line, built the old way and with a reused Builder
+const int columns = 120;
+std::wstring entryName = L"Some Menu Entry";
+NosStdLib::String::Builder<wchar_t> frameBuilder;
+
+for (int frame = 0; frame < 3; frame++)
+{
+    size_t before = AllocationCount;
+    std::wstring oldFrame;
+    for (int i = 0; i < 20; i++)
+    {
+        std::wstring output = std::wstring(((columns / 2) - entryName.length() / 2), ' ') + entryName + std::wstring(4, ' ') + L"<" + std::to_wstring(i * 1000) + L">";
+        output += std::wstring(columns - (output.size() + ((columns / 2) - output.size() / 2)), L' ') + L'\n';
+        oldFrame += output;
+    }
+    oldFrame += NosStdLib::String::CenterString(std::wstring(L"status message"), columns, true);
+    size_t oldAllocations = AllocationCount - before;
+
+    before = AllocationCount;
+    frameBuilder.Clear();
+    for (int i = 0; i < 20; i++)
+    {
+        size_t lineStart = frameBuilder.GetSize();
+        frameBuilder.AppendRepeat(L' ', (columns / 2) - (int)entryName.length() / 2).Append(entryName).AppendRepeat(L' ', 4).AppendFormat(L"<{}>", i * 1000);
+        int lineSize = (int)(frameBuilder.GetSize() - lineStart);
+        frameBuilder.AppendRepeat(L' ', columns - (lineSize + ((columns / 2) - lineSize / 2))).Append(L'\n');
+    }
+    frameBuilder.AppendCentered(L"status message", columns, true);
+    size_t builderAllocations = AllocationCount - before;
+
+    wprintf(L"frame %d: concatenation %zu allocations | Builder %zu allocations%s\n", frame, oldAllocations, builderAllocations, (oldFrame == frameBuilder.GetString() ? L"" : L" | FRAMES DIFFER"));
+}
+*/
+
+/* COMPILE TIME LAYOUT TEST
+#include <NosStdLib/String.hpp>
+#include <chrono>
+
+// everything here gets worked out by the compiler, a mistake in a literal is a compile error instead of a runtime bug
+constexpr int layoutColumns = 80;
+constexpr std::wstring_view menuTitle = L"Main Menu\nPick an option";
+constexpr std::wstring_view optionList = L"Start|Options|Credits|Exit";
+
+constexpr auto centeredTitle = NosStdLib::String::CenterFixed<NosStdLib::String::GetCenteredLength(menuTitle, layoutColumns, true)>(menuTitle, layoutColumns, true);
+constexpr auto optionNames = NosStdLib::String::SplitToArray<NosStdLib::String::CountTokens(optionList, L'|')>(optionList, L'|');
+
+static_assert(optionNames.size() == 4 && optionNames[3] == L"Exit");
+static_assert(NosStdLib::String::IsNumber(L"1920") && !NosStdLib::String::IsNumber(L"19x0"));
+static_assert(centeredTitle.GetSize() == 2 * (layoutColumns + 1));
+
+====MAIN====
+const int frameCount = 100000;
+size_t totalSize = 0;
+
+auto start = std::chrono::high_resolution_clock::now();
+for (int i = 0; i < frameCount; i++)
+    totalSize += NosStdLib::String::CenterString(menuTitle, layoutColumns, true).size();
+std::chrono::duration<double> runtimeTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+for (int i = 0; i < frameCount; i++)
+    totalSize += centeredTitle.GetView().size(); // already built, nothing left to do
+std::chrono::duration<double> constexprTime = std::chrono::high_resolution_clock::now() - start;
+
+wprintf(centeredTitle.GetCString());
+for (std::wstring_view option : optionNames)
+    wprintf(L"%.*ls\n", (int)option.size(), option.data());
+wprintf(L"CenterString per frame: %f us | CenterFixed: %f us (%zu)\n", runtimeTime.count() * 1e6 / frameCount, constexprTime.count() * 1e6 / frameCount, totalSize);
+*/
+
+/* STRING INTERNER BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+
+====MAIN====
+// 200k node names out of 500 distinct ones, stored as wstrings and as interned handles
+const int nodeCount = 200000;
+NosStdLib::String::Interner<wchar_t> interner;
+std::vector<std::wstring> plainNames;
+std::vector<NosStdLib::String::InternedString<wchar_t>> internedNames;
+size_t plainBytes = 0;
+
+for (int i = 0; i < nodeCount; i++)
+{
+    std::wstring name = L"NosStdLib::String::SomeLongFunctionName" + std::to_wstring(i % 500);
+    plainNames.push_back(name);
+    plainBytes += sizeof(std::wstring) + (name.capacity() > 7 ? (name.capacity() + 1) * sizeof(wchar_t) : 0); // small strings fit inside the wstring
+    internedNames.push_back(interner.Intern(name));
+}
+size_t internedBytes = nodeCount * sizeof(NosStdLib::String::InternedString<wchar_t>) + interner.GetBytesUsed();
+
+size_t plainMatches = 0, internedMatches = 0;
+auto start = std::chrono::high_resolution_clock::now();
+for (int i = 1; i < nodeCount; i++)
+    plainMatches += (plainNames[i] == plainNames[i - 1] || plainNames[i] == plainNames[0]);
+std::chrono::duration<double> plainTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+for (int i = 1; i < nodeCount; i++)
+    internedMatches += (internedNames[i] == internedNames[i - 1] || internedNames[i] == internedNames[0]);
+std::chrono::duration<double> internedTime = std::chrono::high_resolution_clock::now() - start;
+
+wprintf(L"wstring: %zu KB, %f ms compare | interned: %zu KB, %f ms compare | %zu distinct%ls\n", plainBytes / 1024, plainTime.count() * 1000,
+        internedBytes / 1024, internedTime.count() * 1000, interner.GetCount(), (plainMatches == internedMatches ? L"" : L" | RESULTS DIFFER"));
+*/
+
+/* CASE AND WHITESPACE PRIMITIVES BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+#include <algorithm>
+#include <cwctype>
+
+====MAIN====
+// 16M characters of words, whitespace runs and new lines, compared against the plain standard library loops
+std::wstring text;
+text.reserve(16000000);
+while (text.size() < 16000000)
+    text += L"Some Words  In A Line\t with   Mixed CASE and spacing\n";
+std::wstring_view view = text;
+
+auto throughput = [&](std::chrono::duration<double> time) { return text.size() / time.count() / 1e9; };
+
+auto start = std::chrono::high_resolution_clock::now();
+size_t stdCount = std::count(text.begin(), text.end(), L'\n');
+std::chrono::duration<double> stdCountTime = std::chrono::high_resolution_clock::now() - start;
+start = std::chrono::high_resolution_clock::now();
+size_t countChar = NosStdLib::String::CountChar(view, L'\n');
+std::chrono::duration<double> countCharTime = std::chrono::high_resolution_clock::now() - start;
+
+std::wstring stdLower = text;
+start = std::chrono::high_resolution_clock::now();
+std::transform(stdLower.begin(), stdLower.end(), stdLower.begin(), [](wchar_t character) { return (wchar_t)std::towlower(character); });
+std::chrono::duration<double> stdLowerTime = std::chrono::high_resolution_clock::now() - start;
+start = std::chrono::high_resolution_clock::now();
+std::wstring lower = NosStdLib::String::ToLower(view);
+std::chrono::duration<double> lowerTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+std::wstring reduced = NosStdLib::String::Reduce(view);
+std::chrono::duration<double> reduceTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+size_t found = NosStdLib::String::FindIgnoreCase(view, L"MIXED CASE AND SPACING!");
+std::chrono::duration<double> findTime = std::chrono::high_resolution_clock::now() - start;
+
+wprintf(L"std::count: %f | CountChar: %f G chars/s%ls\n", throughput(stdCountTime), throughput(countCharTime), (stdCount == countChar ? L"" : L" | RESULTS DIFFER"));
+wprintf(L"towlower transform: %f | ToLower: %f G chars/s%ls\n", throughput(stdLowerTime), throughput(lowerTime), (stdLower == lower ? L"" : L" | RESULTS DIFFER"));
+wprintf(L"Reduce: %f G chars/s (%zu -> %zu chars)\n", throughput(reduceTime), text.size(), reduced.size());
+wprintf(L"FindIgnoreCase (no match, every 'm' is a candidate): %f G chars/s%ls\n", throughput(findTime), (found == std::wstring_view::npos ? L"" : L" | WRONG RESULT"));
+*/
+
+/* BOOL PARSING BENCHMARK
+#include <NosStdLib/String.hpp>
+#include <chrono>
+#include <algorithm>
+#include <cwctype>
+#include <memory>
+
+====MAIN====
+// 5M config values in mixed case, parsed with lower case + string compares (the old stob way), ParseBool per value and ParseBoolColumn
+const wchar_t* tokenList[] = { L"true", L"False", L"YES", L"no", L"On", L"off", L"1", L"0" };
+const int valueCount = 5000000;
+std::vector<std::wstring> values;
+std::wstring column;
+values.reserve(valueCount);
+for (int i = 0; i < valueCount; i++)
+{
+    values.emplace_back(tokenList[(i * 7) % 8]);
+    column += values.back() + L'\n';
+}
+std::unique_ptr<bool[]> columnValues(new bool[valueCount]()); // zeroed up front so the timing doesn't include first touching the memory
+
+size_t stobTrue = 0, parseTrue = 0, columnTrue = 0;
+auto start = std::chrono::high_resolution_clock::now();
+for (const std::wstring& value : values)
+{
+    std::wstring lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](wchar_t character) { return (wchar_t)std::towlower(character); });
+    stobTrue += (lower == L"true" || lower == L"yes" || lower == L"on" || lower == L"1");
+}
+std::chrono::duration<double> stobTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+for (const std::wstring& value : values)
+{
+    bool parsed = false;
+    NosStdLib::String::ParseBool(value, parsed);
+    parseTrue += parsed;
+}
+std::chrono::duration<double> parseTime = std::chrono::high_resolution_clock::now() - start;
+
+start = std::chrono::high_resolution_clock::now();
+size_t parsedCount = NosStdLib::String::ParseBoolColumn(column, std::span<bool>(columnValues.get(), valueCount));
+for (size_t i = 0; i < parsedCount; i++)
+    columnTrue += columnValues[i];
+std::chrono::duration<double> columnTime = std::chrono::high_resolution_clock::now() - start;
+
+wprintf(L"lower + compare: %f ns | ParseBool: %f ns | ParseBoolColumn: %f ns per value%ls\n", stobTime.count() * 1e9 / valueCount, parseTime.count() * 1e9 / valueCount,
+        columnTime.count() * 1e9 / valueCount, (stobTrue == parseTrue && parseTrue == columnTrue && parsedCount == valueCount ? L"" : L" | RESULTS DIFFER"));
+*/
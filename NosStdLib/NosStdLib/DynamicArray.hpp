@@ -2,303 +2,3136 @@
 #define _DYNAMICARRAY_NOSSTDLIB_HPP_
 
 #include <iostream>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+#include <climits>
+#include <stdint.h>
+#include <bit>
+#include <utility>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <span>
+#include <string_view>
+
+#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+#include <mutex>
+#include <unordered_set>
+#include <map>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <typeinfo>
+#endif
+
+#include "Simd.hpp"
+#include "Threading.hpp"
 
 namespace NosStdLib
 {
-	/* TODO: Add modes (such as double mode were the array doubles in size instead of increasing by stepsize) */
+	/// <summary>
+	/// Modes which decide how a DynamicArray grows once it reaches the limit
+	/// </summary>
+	enum ResizeMode : uint8_t
+	{
+		StepMode = 0,		/* array increases by the step size (linear growth) */
+		DoubleMode = 1,		/* array doubles in size (geometric growth) */
+		OneAndHalfMode = 2,	/* array increases by half of its size (geometric growth) */
+		CustomMode = 3,		/* array size gets calculated by a user supplied function */
+	};
+
+	/// <summary>
+	/// namespace for functions which get shared between the DynamicArray classes
+	/// </summary>
+	namespace DynamicArrayUtilities
+	{
+		/// <summary>
+		/// if the type is a character type (which gets treated as text by AsStringView and the stream operators)
+		/// </summary>
+		template<class DataType>
+		constexpr bool IsCharType = (std::is_same_v<DataType, char> || std::is_same_v<DataType, wchar_t> || std::is_same_v<DataType, char8_t> || std::is_same_v<DataType, char16_t> || std::is_same_v<DataType, char32_t>);
+
+		/// <summary>
+		/// Moves objects from one raw array into another and destroys the originals.
+		/// trivially copyable types get memcpy'd, types that can't throw while moving get moved, any other type gets copied so the original stays intact if copying throws
+		/// </summary>
+		/// <typeparam name="ArrayDataType">- datatype of the objects</typeparam>
+		/// <param name="source">- array to move from</param>
+		/// <param name="destination">- array (raw memory) to move to</param>
+		/// <param name="count">- amount of objects to move</param>
+		template<class ArrayDataType>
+		void RelocateObjects(ArrayDataType* source, ArrayDataType* destination, const int& count)
+		{
+			if (count <= 0)
+				return;
+
+			if constexpr (std::is_trivially_copyable_v<ArrayDataType>)
+			{
+				std::memcpy(destination, source, sizeof(ArrayDataType) * count); /* trivially copyable objects don't need destroying */
+			}
+			else
+			{
+				if constexpr (std::is_nothrow_move_constructible_v<ArrayDataType> || !std::is_copy_constructible_v<ArrayDataType>)
+					std::uninitialized_move(source, source + count, destination);
+				else
+					std::uninitialized_copy(source, source + count, destination);
+
+				std::destroy(source, source + count);
+			}
+		}
+
+		/// <summary>
+		/// Constructs a new object at destination[count] and then relocates the count objects from source in front of it (used when growing on append).
+		/// if constructing or relocating throws, everything built in destination gets destroyed and source stays untouched, so the caller only has to free destination
+		/// </summary>
+		/// <typeparam name="ArrayDataType">- datatype of the objects</typeparam>
+		/// <typeparam name="...VariadicArgs">- the constructor parameter types</typeparam>
+		/// <param name="source">- array to move from</param>
+		/// <param name="destination">- array (raw memory) to move to, has to have space for count + 1 objects</param>
+		/// <param name="count">- amount of objects to move</param>
+		/// <param name="...args">- the constructor parameters for the new object</param>
+		template<class ArrayDataType, typename ... VariadicArgs>
+		void EmplaceAndRelocate(ArrayDataType* source, ArrayDataType* destination, const int& count, VariadicArgs&& ... args)
+		{
+			/* construct the new object before moving the old ones, the args might reference objects inside of source */
+			new (&destination[count]) ArrayDataType(std::forward<VariadicArgs>(args)...);
+
+			try
+			{
+				RelocateObjects(source, destination, count);
+			}
+			catch (...)
+			{
+				std::destroy_at(&destination[count]);
+				throw;
+			}
+		}
+	}
+
+	/// <summary>
+	/// namespace for the search and reduction kernels used by DynamicArray. int32, float and double get vectorized (SSE2/AVX2), every other type uses the scalar loops
+	/// </summary>
+	namespace DynamicArrayKernels
+	{
+		/// <summary>
+		/// Type which the Sum of a type gets returned as (integers -> 64 bit, float -> double so big arrays don't lose precision)
+		/// </summary>
+		template<class DataType>
+		using SumType = std::conditional_t<std::is_integral_v<DataType>, std::conditional_t<std::is_signed_v<DataType>, long long, unsigned long long>,
+							std::conditional_t<std::is_same_v<DataType, float>, double, DataType>>;
+
+	#pragma region Find
+		/// <summary>
+		/// Finds the first position of the value
+		/// </summary>
+		/// <typeparam name="DataType">- datatype of the array</typeparam>
+		/// <param name="data">- pointer to the first object</param>
+		/// <param name="count">- amount of objects</param>
+		/// <param name="value">- value to look for</param>
+		/// <returns>position of the value or -1 if it wasn't found</returns>
+		template<class DataType>
+		int Find(const DataType* data, const int& count, const DataType& value)
+		{
+			int i = 0;
+
+		#if defined(NOSSTDLIB_AVX2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				__m256i needle = _mm256_set1_epi32(value);
+				for (; i + 8 <= count; i += 8)
+				{
+					unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), needle));
+					if (mask != 0)
+						return i + std::countr_zero(mask) / 4;
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				__m256 needle = _mm256_set1_ps(value);
+				for (; i + 8 <= count; i += 8)
+				{
+					unsigned mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ));
+					if (mask != 0)
+						return i + std::countr_zero(mask);
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				__m256d needle = _mm256_set1_pd(value);
+				for (; i + 4 <= count; i += 4)
+				{
+					unsigned mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i), needle, _CMP_EQ_OQ));
+					if (mask != 0)
+						return i + std::countr_zero(mask);
+				}
+			}
+		#elif defined(NOSSTDLIB_SSE2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				__m128i needle = _mm_set1_epi32(value);
+				for (; i + 4 <= count; i += 4)
+				{
+					unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), needle));
+					if (mask != 0)
+						return i + std::countr_zero(mask) / 4;
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				__m128 needle = _mm_set1_ps(value);
+				for (; i + 4 <= count; i += 4)
+				{
+					unsigned mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle));
+					if (mask != 0)
+						return i + std::countr_zero(mask);
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				__m128d needle = _mm_set1_pd(value);
+				for (; i + 2 <= count; i += 2)
+				{
+					unsigned mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i), needle));
+					if (mask != 0)
+						return i + std::countr_zero(mask);
+				}
+			}
+		#endif
+
+			for (; i < count; i++) /* scalar loop for the tail (and for types without a vectorized kernel) */
+			{
+				if (data[i] == value)
+					return i;
+			}
+			return -1;
+		}
+	#pragma endregion
+
+	#pragma region Count
+		/// <summary>
+		/// Counts how many times the value is in the array
+		/// </summary>
+		/// <typeparam name="DataType">- datatype of the array</typeparam>
+		/// <param name="data">- pointer to the first object</param>
+		/// <param name="count">- amount of objects</param>
+		/// <param name="value">- value to count</param>
+		/// <returns>amount of times the value was found</returns>
+		template<class DataType>
+		int Count(const DataType* data, const int& count, const DataType& value)
+		{
+			int i = 0, found = 0;
+
+		#if defined(NOSSTDLIB_AVX2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				__m256i needle = _mm256_set1_epi32(value);
+				for (; i + 8 <= count; i += 8)
+					found += std::popcount((unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), needle))));
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				__m256 needle = _mm256_set1_ps(value);
+				for (; i + 8 <= count; i += 8)
+					found += std::popcount((unsigned)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ)));
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				__m256d needle = _mm256_set1_pd(value);
+				for (; i + 4 <= count; i += 4)
+					found += std::popcount((unsigned)_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i), needle, _CMP_EQ_OQ)));
+			}
+		#elif defined(NOSSTDLIB_SSE2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				__m128i needle = _mm_set1_epi32(value);
+				for (; i + 4 <= count; i += 4)
+					found += std::popcount((unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), needle))));
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				__m128 needle = _mm_set1_ps(value);
+				for (; i + 4 <= count; i += 4)
+					found += std::popcount((unsigned)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle)));
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				__m128d needle = _mm_set1_pd(value);
+				for (; i + 2 <= count; i += 2)
+					found += std::popcount((unsigned)_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i), needle)));
+			}
+		#endif
+
+			for (; i < count; i++)
+			{
+				if (data[i] == value)
+					found++;
+			}
+			return found;
+		}
+	#pragma endregion
+
+	#pragma region Sum
+		/// <summary>
+		/// Adds all the objects together
+		/// </summary>
+		/// <typeparam name="DataType">- datatype of the array</typeparam>
+		/// <param name="data">- pointer to the first object</param>
+		/// <param name="count">- amount of objects</param>
+		/// <returns>sum of all the objects (as SumType)</returns>
+		template<class DataType>
+		SumType<DataType> Sum(const DataType* data, const int& count)
+		{
+			int i = 0;
+			SumType<DataType> total = SumType<DataType>();
+
+		#if defined(NOSSTDLIB_AVX2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				__m256i accumulator = _mm256_setzero_si256();
+				for (; i + 4 <= count; i += 4) /* widen 4 ints to 64 bit so the sum can't overflow */
+					accumulator = _mm256_add_epi64(accumulator, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(data + i))));
+
+				alignas(32) long long lanes[4];
+				_mm256_store_si256((__m256i*)lanes, accumulator);
+				total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				__m256d accumulator = _mm256_setzero_pd();
+				for (; i + 4 <= count; i += 4) /* widen 4 floats to double */
+					accumulator = _mm256_add_pd(accumulator, _mm256_cvtps_pd(_mm_loadu_ps(data + i)));
+
+				alignas(32) double lanes[4];
+				_mm256_store_pd(lanes, accumulator);
+				total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				__m256d accumulator = _mm256_setzero_pd();
+				for (; i + 4 <= count; i += 4)
+					accumulator = _mm256_add_pd(accumulator, _mm256_loadu_pd(data + i));
+
+				alignas(32) double lanes[4];
+				_mm256_store_pd(lanes, accumulator);
+				total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+			}
+		#elif defined(NOSSTDLIB_SSE2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				__m128i accumulator = _mm_setzero_si128();
+				for (; i + 4 <= count; i += 4) /* sign extend to 64 bit by unpacking with the sign mask (SSE2 doesn't have cvtepi32_epi64) */
+				{
+					__m128i values = _mm_loadu_si128((const __m128i*)(data + i));
+					__m128i signs = _mm_srai_epi32(values, 31);
+					accumulator = _mm_add_epi64(accumulator, _mm_unpacklo_epi32(values, signs));
+					accumulator = _mm_add_epi64(accumulator, _mm_unpackhi_epi32(values, signs));
+				}
+
+				alignas(16) long long lanes[2];
+				_mm_store_si128((__m128i*)lanes, accumulator);
+				total = lanes[0] + lanes[1];
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				__m128d accumulator = _mm_setzero_pd();
+				for (; i + 4 <= count; i += 4)
+				{
+					__m128 values = _mm_loadu_ps(data + i);
+					accumulator = _mm_add_pd(accumulator, _mm_cvtps_pd(values));
+					accumulator = _mm_add_pd(accumulator, _mm_cvtps_pd(_mm_movehl_ps(values, values)));
+				}
+
+				alignas(16) double lanes[2];
+				_mm_store_pd(lanes, accumulator);
+				total = lanes[0] + lanes[1];
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				__m128d accumulator = _mm_setzero_pd();
+				for (; i + 2 <= count; i += 2)
+					accumulator = _mm_add_pd(accumulator, _mm_loadu_pd(data + i));
+
+				alignas(16) double lanes[2];
+				_mm_store_pd(lanes, accumulator);
+				total = lanes[0] + lanes[1];
+			}
+		#endif
+
+			for (; i < count; i++)
+				total = total + data[i];
+			return total;
+		}
+	#pragma endregion
+
+	#pragma region MinMax
+		/// <summary>
+		/// Finds the smallest and biggest object in one pass.
+		/// WARNING: the vectorized float/double kernels don't handle NaN the same way as the scalar loop
+		/// </summary>
+		/// <typeparam name="DataType">- datatype of the array</typeparam>
+		/// <param name="data">- pointer to the first object</param>
+		/// <param name="count">- amount of objects (has to be bigger then 0)</param>
+		/// <returns>pair of (smallest, biggest)</returns>
+		template<class DataType>
+		std::pair<DataType, DataType> MinMax(const DataType* data, const int& count)
+		{
+			int i = 0;
+			DataType smallest = data[0], biggest = data[0];
+
+		#if defined(NOSSTDLIB_AVX2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				if (count >= 8)
+				{
+					__m256i minimum = _mm256_loadu_si256((const __m256i*)data), maximum = minimum;
+					for (i = 8; i + 8 <= count; i += 8)
+					{
+						__m256i values = _mm256_loadu_si256((const __m256i*)(data + i));
+						minimum = _mm256_min_epi32(minimum, values);
+						maximum = _mm256_max_epi32(maximum, values);
+					}
+
+					alignas(32) int32_t minimumLanes[8], maximumLanes[8];
+					_mm256_store_si256((__m256i*)minimumLanes, minimum);
+					_mm256_store_si256((__m256i*)maximumLanes, maximum);
+					smallest = *std::min_element(minimumLanes, minimumLanes + 8);
+					biggest = *std::max_element(maximumLanes, maximumLanes + 8);
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				if (count >= 8)
+				{
+					__m256 minimum = _mm256_loadu_ps(data), maximum = minimum;
+					for (i = 8; i + 8 <= count; i += 8)
+					{
+						__m256 values = _mm256_loadu_ps(data + i);
+						minimum = _mm256_min_ps(minimum, values);
+						maximum = _mm256_max_ps(maximum, values);
+					}
+
+					alignas(32) float minimumLanes[8], maximumLanes[8];
+					_mm256_store_ps(minimumLanes, minimum);
+					_mm256_store_ps(maximumLanes, maximum);
+					smallest = *std::min_element(minimumLanes, minimumLanes + 8);
+					biggest = *std::max_element(maximumLanes, maximumLanes + 8);
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				if (count >= 4)
+				{
+					__m256d minimum = _mm256_loadu_pd(data), maximum = minimum;
+					for (i = 4; i + 4 <= count; i += 4)
+					{
+						__m256d values = _mm256_loadu_pd(data + i);
+						minimum = _mm256_min_pd(minimum, values);
+						maximum = _mm256_max_pd(maximum, values);
+					}
+
+					alignas(32) double minimumLanes[4], maximumLanes[4];
+					_mm256_store_pd(minimumLanes, minimum);
+					_mm256_store_pd(maximumLanes, maximum);
+					smallest = *std::min_element(minimumLanes, minimumLanes + 4);
+					biggest = *std::max_element(maximumLanes, maximumLanes + 4);
+				}
+			}
+		#elif defined(NOSSTDLIB_SSE2)
+			if constexpr (std::is_same_v<DataType, int32_t>)
+			{
+				if (count >= 4)
+				{
+					__m128i minimum = _mm_loadu_si128((const __m128i*)data), maximum = minimum;
+					for (i = 4; i + 4 <= count; i += 4) /* SSE2 doesn't have min/max for int32, so select with a compare mask */
+					{
+						__m128i values = _mm_loadu_si128((const __m128i*)(data + i));
+						__m128i lessMask = _mm_cmplt_epi32(values, minimum);
+						__m128i greaterMask = _mm_cmpgt_epi32(values, maximum);
+						minimum = _mm_or_si128(_mm_and_si128(lessMask, values), _mm_andnot_si128(lessMask, minimum));
+						maximum = _mm_or_si128(_mm_and_si128(greaterMask, values), _mm_andnot_si128(greaterMask, maximum));
+					}
+
+					alignas(16) int32_t minimumLanes[4], maximumLanes[4];
+					_mm_store_si128((__m128i*)minimumLanes, minimum);
+					_mm_store_si128((__m128i*)maximumLanes, maximum);
+					smallest = *std::min_element(minimumLanes, minimumLanes + 4);
+					biggest = *std::max_element(maximumLanes, maximumLanes + 4);
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, float>)
+			{
+				if (count >= 4)
+				{
+					__m128 minimum = _mm_loadu_ps(data), maximum = minimum;
+					for (i = 4; i + 4 <= count; i += 4)
+					{
+						__m128 values = _mm_loadu_ps(data + i);
+						minimum = _mm_min_ps(minimum, values);
+						maximum = _mm_max_ps(maximum, values);
+					}
+
+					alignas(16) float minimumLanes[4], maximumLanes[4];
+					_mm_store_ps(minimumLanes, minimum);
+					_mm_store_ps(maximumLanes, maximum);
+					smallest = *std::min_element(minimumLanes, minimumLanes + 4);
+					biggest = *std::max_element(maximumLanes, maximumLanes + 4);
+				}
+			}
+			else if constexpr (std::is_same_v<DataType, double>)
+			{
+				if (count >= 2)
+				{
+					__m128d minimum = _mm_loadu_pd(data), maximum = minimum;
+					for (i = 2; i + 2 <= count; i += 2)
+					{
+						__m128d values = _mm_loadu_pd(data + i);
+						minimum = _mm_min_pd(minimum, values);
+						maximum = _mm_max_pd(maximum, values);
+					}
+
+					alignas(16) double minimumLanes[2], maximumLanes[2];
+					_mm_store_pd(minimumLanes, minimum);
+					_mm_store_pd(maximumLanes, maximum);
+					smallest = (minimumLanes[1] < minimumLanes[0] ? minimumLanes[1] : minimumLanes[0]);
+					biggest = (maximumLanes[0] < maximumLanes[1] ? maximumLanes[1] : maximumLanes[0]);
+				}
+			}
+		#endif
+
+			for (; i < count; i++)
+			{
+				if (data[i] < smallest)
+					smallest = data[i];
+				if (biggest < data[i])
+					biggest = data[i];
+			}
+			return { smallest, biggest };
+		}
+	#pragma endregion
+	}
+
+#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+	/// <summary>
+	/// Growth statistics of a single DynamicArray. only exists when NOSSTDLIB_DYNAMICARRAY_STATISTICS is defined before including the header,
+	/// otherwise the member and all the counting gets compiled out
+	/// </summary>
+	class DynamicArrayStatistics
+	{
+	private:
+		const int* CapacityPointer;	/* ArraySize of the owning array */
+		const int* CountPointer;	/* ArrayIndexPointer of the owning array */
+	public:
+		const char* Name;			/* name given with SetStatisticsName (nullptr if none) */
+		const char* TypeName;		/* typeid name of the object type */
+		size_t ObjectSize;			/* sizeof the object type */
+		long long ResizeCount;		/* amount of reallocations */
+		long long BytesMoved;		/* bytes copied/moved into new arrays by reallocations */
+		long long AppendCount;		/* objects appended (MultiAppend counts every object) */
+		int PeakCapacity;			/* biggest the array has been */
+		long long InstanceCount;	/* amount of arrays merged into this one (only used for destroyed arrays) */
+
+		DynamicArrayStatistics(const int* capacityPointer, const int* countPointer, const char* typeName, const size_t& objectSize);
+		DynamicArrayStatistics(const DynamicArrayStatistics&) = delete;
+		DynamicArrayStatistics& operator=(const DynamicArrayStatistics&) = delete;
+		~DynamicArrayStatistics();
+
+		/// <summary>
+		/// Gets the current capacity of the owning array
+		/// </summary>
+		int GetCapacity() const { return (CapacityPointer != nullptr ? *CapacityPointer : 0); }
+
+		/// <summary>
+		/// Gets the current amount of objects in the owning array
+		/// </summary>
+		int GetCount() const { return (CountPointer != nullptr ? *CountPointer : 0); }
+
+		/// <summary>
+		/// Records a reallocation
+		/// </summary>
+		/// <param name="movedObjects">- amount of objects moved into the new array</param>
+		/// <param name="newCapacity">- capacity of the new array</param>
+		void RecordResize(const int& movedObjects, const int& newCapacity)
+		{
+			ResizeCount++;
+			BytesMoved += (long long)movedObjects * ObjectSize;
+			PeakCapacity = (newCapacity > PeakCapacity ? newCapacity : PeakCapacity);
+		}
+	};
+
+	/// <summary>
+	/// Global registry of every DynamicArrayStatistics. live arrays get listed on their own, destroyed arrays get merged together by name and type
+	/// </summary>
+	class DynamicArrayStatisticsRegistry
+	{
+	private:
+		std::mutex RegistryMutex;												/* guards both containers */
+		std::unordered_set<DynamicArrayStatistics*> LiveStatistics;				/* statistics of the arrays which still exist */
+		std::map<std::pair<std::string, std::string>, DynamicArrayStatistics> RetiredStatistics;	/* merged statistics of destroyed arrays, key is (name, type) */
+
+		/// <summary>
+		/// Writes one row of the table
+		/// </summary>
+		static void WriteRow(std::wostream& os, const DynamicArrayStatistics& statistics, const bool& live)
+		{
+			int capacity = (live ? statistics.GetCapacity() : 0), count = (live ? statistics.GetCount() : 0);
+			int peak = (capacity > statistics.PeakCapacity ? capacity : statistics.PeakCapacity);
+			std::string name = (statistics.Name != nullptr ? statistics.Name : "(unnamed)");
+
+			os << std::left << std::setw(24) << std::wstring(name.begin(), name.end())
+			   << std::setw(8) << (live ? L"live" : L"dead") << std::right
+			   << std::setw(10) << statistics.InstanceCount
+			   << std::setw(12) << capacity
+			   << std::setw(12) << count
+			   << std::setw(14) << (long long)(capacity - count) * statistics.ObjectSize
+			   << std::setw(12) << peak
+			   << std::setw(10) << statistics.ResizeCount
+			   << std::setw(16) << statistics.BytesMoved
+			   << std::setw(12) << statistics.AppendCount << L"  ";
+			for (const char* typeName = statistics.TypeName; *typeName != '\0'; typeName++)
+			{
+				os << (wchar_t)*typeName;
+			}
+			os << L'\n';
+		}
+	public:
+		/// <summary>
+		/// Gets the registry
+		/// </summary>
+		static DynamicArrayStatisticsRegistry& GetRegistry()
+		{
+			static DynamicArrayStatisticsRegistry registry;
+			return registry;
+		}
+
+		void Register(DynamicArrayStatistics* statistics)
+		{
+			std::lock_guard<std::mutex> lock(RegistryMutex);
+			LiveStatistics.insert(statistics);
+		}
+
+		/// <summary>
+		/// Removes the statistics from the live list and merges them into the retired ones
+		/// </summary>
+		void Unregister(DynamicArrayStatistics* statistics)
+		{
+			std::lock_guard<std::mutex> lock(RegistryMutex);
+			LiveStatistics.erase(statistics);
+
+			std::pair<std::string, std::string> key((statistics->Name != nullptr ? statistics->Name : ""), statistics->TypeName);
+			auto found = RetiredStatistics.try_emplace(key, nullptr, nullptr, statistics->TypeName, statistics->ObjectSize).first;
+			DynamicArrayStatistics& retired = found->second;
+			int peak = statistics->GetCapacity();
+			peak = (statistics->PeakCapacity > peak ? statistics->PeakCapacity : peak);
+
+			retired.Name = statistics->Name;
+			retired.InstanceCount++;
+			retired.ResizeCount += statistics->ResizeCount;
+			retired.BytesMoved += statistics->BytesMoved;
+			retired.AppendCount += statistics->AppendCount;
+			retired.PeakCapacity = (peak > retired.PeakCapacity ? peak : retired.PeakCapacity);
+		}
+
+		/// <summary>
+		/// Writes a table of every array, sorted by bytes moved (the arrays which need a bigger startSize/stepSize first).
+		/// WARNING: the arrays aren't locked, don't dump while other threads modify arrays
+		/// </summary>
+		/// <param name="os">(default = std::wcout) - stream to write to</param>
+		void DumpTable(std::wostream& os = std::wcout)
+		{
+			std::lock_guard<std::mutex> lock(RegistryMutex);
+			std::vector<std::pair<const DynamicArrayStatistics*, bool>> rows;
+			for (const DynamicArrayStatistics* statistics : LiveStatistics)
+			{
+				rows.emplace_back(statistics, true);
+			}
+			for (const auto& [key, statistics] : RetiredStatistics)
+			{
+				rows.emplace_back(&statistics, false);
+			}
+			std::sort(rows.begin(), rows.end(), [](const auto& left, const auto& right) { return left.first->BytesMoved > right.first->BytesMoved; });
+
+			os << std::left << std::setw(24) << L"Name" << std::setw(8) << L"State" << std::right << std::setw(10) << L"Instances" << std::setw(12) << L"Capacity"
+			   << std::setw(12) << L"Count" << std::setw(14) << L"Slack bytes" << std::setw(12) << L"Peak" << std::setw(10) << L"Resizes"
+			   << std::setw(16) << L"Bytes moved" << std::setw(12) << L"Appends" << L"  Type\n";
+			for (const auto& [statistics, live] : rows)
+			{
+				WriteRow(os, *statistics, live);
+			}
+		}
+	};
+
+	inline DynamicArrayStatistics::DynamicArrayStatistics(const int* capacityPointer, const int* countPointer, const char* typeName, const size_t& objectSize)
+		: CapacityPointer(capacityPointer), CountPointer(countPointer), Name(nullptr), TypeName(typeName), ObjectSize(objectSize),
+		  ResizeCount(0), BytesMoved(0), AppendCount(0), PeakCapacity(0), InstanceCount(1)
+	{
+		if (CapacityPointer != nullptr) /* retired entries (no owning array) don't get registered */
+			DynamicArrayStatisticsRegistry::GetRegistry().Register(this);
+		else
+			InstanceCount = 0;
+	}
+
+	inline DynamicArrayStatistics::~DynamicArrayStatistics()
+	{
+		if (CapacityPointer != nullptr)
+			DynamicArrayStatisticsRegistry::GetRegistry().Unregister(this);
+	}
+#endif
 
 	/// <summary>
 	/// Class which allows for making arrays that can self increase on data overflow
 	/// </summary>
 	/// <typeparam name="ArrayDataType">- datatype for the array</typeparam>
-	template<class ArrayDataType>
+	/// <typeparam name="Allocator">(default = std::allocator) - std compatible allocator which provides the memory (use PmrDynamicArray for memory resources)</typeparam>
+	template<class ArrayDataType, class Allocator = std::allocator<ArrayDataType>>
 	class DynamicArray
 	{
 	private:
+		static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, ArrayDataType>, "Allocator value_type has to be the same as ArrayDataType");
+
+		Allocator ArrayAllocator;	/* allocator which provides the raw memory */
 		int ArraySize;				/* Array starting sizeand the size after it is resized */
 		int ArrayDefaultSize;		/* Array starting size which doesn't change */
-		ArrayDataType* MainArray;	/* Pointer to Array */
+		ArrayDataType* MainArray;	/* Pointer to Array (raw memory, only the first ArrayIndexPointer objects are constructed) */
 		int ArrayIndexPointer;		/* keeps track amount of objects in array */
 		int ArrayStepSize;			/* how much the array will get increased by when it reaches the limit */
+		ResizeMode ArrayResizeMode;	/* how the array will grow when it reaches the limit */
+		std::function<int(const int&)> ArrayResizeFunction; /* function which calculates new size from the current size (only used with CustomMode) */
+	#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+		DynamicArrayStatistics Statistics{ &ArraySize, &ArrayIndexPointer, typeid(ArrayDataType).name(), sizeof(ArrayDataType) }; /* growth statistics, every array registers its own (never copied or moved) */
+	#endif
 
 		typedef ArrayDataType* iterator;
 		typedef const ArrayDataType* const_iterator;
 	public:
 	#pragma region Constructors
 		/// <summary>
-		/// Constructor with starting size and step size params for custom objects
+		/// Constructor with starting size and step size params for custom objects
+		/// </summary>
+		/// <param name="StartSize"> - Starting size of the array</param>
+		/// <param name="StepSize"> - how much the array will increase each time it reaches the limit</param>
+		/// <param name="resizeMode">(default = StepMode) - how the array grows when it reaches the limit (stepSize only gets used with StepMode)</param>
+		/// <param name="allocator">(default = Allocator()) - the allocator to get memory from</param>
+		DynamicArray(const int& startSize, const int& stepSize, const ResizeMode& resizeMode = StepMode, const Allocator& allocator = Allocator()) : ArrayAllocator(allocator)
+		{
+			ArrayDefaultSize = ArraySize = startSize;
+			ArrayStepSize = stepSize;
+			ArrayResizeMode = resizeMode;
+
+			// ! DO NOT CHANGE !
+			ArrayIndexPointer = 0;
+			MainArray = AllocateArray(ArraySize);
+		}
+
+		/// <summary>
+		/// Constructor with starting size and a custom function which calculates the new size
+		/// </summary>
+		/// <param name="startSize">- Starting size of the array</param>
+		/// <param name="resizeFunction">- function which takes in the current size and returns the new size</param>
+		/// <param name="allocator">(default = Allocator()) - the allocator to get memory from</param>
+		DynamicArray(const int& startSize, const std::function<int(const int&)>& resizeFunction, const Allocator& allocator = Allocator()) : DynamicArray(startSize, 0, CustomMode, allocator)
+		{
+			ArrayResizeFunction = resizeFunction;
+		}
+
+		/// <summary>
+		/// Constructor to set all the variables
+		/// </summary>
+		DynamicArray() : DynamicArray(10, 10) {}
+
+		/// <summary>
+		/// Constructor with default sizes which gets memory from the allocator (a memory resource pointer works for PmrDynamicArray)
+		/// </summary>
+		/// <param name="allocator">- the allocator to get memory from</param>
+		explicit DynamicArray(const Allocator& allocator) : DynamicArray(10, 10, StepMode, allocator) {}
+
+		/// <summary>
+		/// Copy constructor, allocates once and copies all the objects and settings
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		DynamicArray(const DynamicArray& other) : ArrayAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.ArrayAllocator))
+		{
+			CopySettings(other);
+			int newSize = (other.ArrayIndexPointer > other.ArrayDefaultSize ? other.ArrayIndexPointer : other.ArrayDefaultSize);
+			ArrayDataType* NewArray = AllocateArray(newSize);
+
+			try /* the destructor doesn't run if a constructor throws, so the memory has to be given back here */
+			{
+				std::uninitialized_copy(other.MainArray, other.MainArray + other.ArrayIndexPointer, NewArray);
+			}
+			catch (...)
+			{
+				DeallocateArray(NewArray, newSize);
+				throw;
+			}
+
+			MainArray = NewArray;
+			ArraySize = newSize;
+			ArrayIndexPointer = other.ArrayIndexPointer;
+		}
+
+		/// <summary>
+		/// Move constructor, steals the array from the other object in O(1). the other object is left empty (but still usable)
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		DynamicArray(DynamicArray&& other) noexcept : ArrayAllocator(std::move(other.ArrayAllocator))
+		{
+			CopySettings(other);
+			StealArray(other);
+		}
+
+		/// Destroy array contained in object
+		~DynamicArray()
+		{
+			std::destroy(MainArray, MainArray + ArrayIndexPointer);
+			DeallocateArray(MainArray, ArraySize);
+		}
+	#pragma endregion
+
+	#pragma region MainArray Modification
+		/// <summary>
+		/// Construct an Object in place at the end of the array
+		/// </summary>
+		/// <typeparam name="...VariadicArgs">- the constructor parameter types</typeparam>
+		/// <param name="...args">- the constructor parameters</param>
+		/// <returns>reference to the constructed Object</returns>
+		template<typename ... VariadicArgs>
+		ArrayDataType& EmplaceAppend(VariadicArgs&& ... args)
+		{
+			if (ArrayIndexPointer >= ArraySize) // if Current Index pointer is more then the array size (trying to add to OutOfRange space)
+			{
+				int newSize = CalculateNewSize(ArrayIndexPointer + 1);
+				ArrayDataType* NewArray = AllocateArray(newSize);
+
+				try
+				{
+					DynamicArrayUtilities::EmplaceAndRelocate(MainArray, NewArray, ArrayIndexPointer, std::forward<VariadicArgs>(args)...);
+				}
+				catch (...)
+				{
+					DeallocateArray(NewArray, newSize);
+					throw;
+				}
+				AdoptArray(NewArray, newSize);
+			}
+			else
+			{
+				new (&MainArray[ArrayIndexPointer]) ArrayDataType(std::forward<VariadicArgs>(args)...);
+			}
+
+		#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+			Statistics.AppendCount++;
+		#endif
+			return MainArray[ArrayIndexPointer++];
+		}
+
+		/// <summary>
+		/// Append single Object
+		/// </summary>
+		/// <param name="ObjectToAdd"> - Object to add</param>
+		void Append(const ArrayDataType& objectToAdd)
+		{
+			EmplaceAppend(objectToAdd);
+		}
+
+		/// <summary>
+		/// Append single Object by moving it
+		/// </summary>
+		/// <param name="objectToAdd">- Object to move in</param>
+		void Append(ArrayDataType&& objectToAdd)
+		{
+			EmplaceAppend(std::move(objectToAdd));
+		}
+
+		/// <summary>
+		/// Adds from the beginning address to the range to the end of current array. Grows at most once and copies all the objects in one pass
+		/// </summary>
+		/// <param name="beginning">- the beginning address</param>
+		/// <param name="range">- the range of items wanted</param>
+		void MultiAppend(const ArrayDataType* beginning, const int& range)
+		{
+			if (range <= 0)
+				return;
+
+			if (ArrayIndexPointer + range > ArraySize)
+			{
+				/* if the objects are inside of MainArray (appending to self), they get moved with the resize so find them again after */
+				bool insideSelf = (beginning >= MainArray && beginning < MainArray + ArrayIndexPointer);
+				ptrdiff_t selfOffset = beginning - MainArray;
+
+				Resize(CalculateNewSize(ArrayIndexPointer + range));
+
+				if (insideSelf)
+					beginning = MainArray + selfOffset;
+			}
+
+			std::uninitialized_copy(beginning, beginning + range, MainArray + ArrayIndexPointer);
+			ArrayIndexPointer += range;
+		#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+			Statistics.AppendCount += range;
+		#endif
+		}
+
+		/// <summary>
+		/// Adds from beginning address to end address to the end of current array
+		/// </summary>
+		/// <param name="beginning">- the beginning address</param>
+		/// <param name="end">- the end address</param>
+		void MultiAppend(const ArrayDataType* beginning, const ArrayDataType* end) /* TODO: Allow for custom starting point */
+		{
+			int distance = std::distance(beginning, end);
+			MultiAppend(beginning, distance);
+		}
+
+		/// <summary>
+		/// Adds all the objects in the span to the end of current array (works with anything contiguous, std::vector, std::array, other DynamicArrays...)
+		/// </summary>
+		/// <param name="objects">- the objects to add</param>
+		void MultiAppend(std::span<const ArrayDataType> objects)
+		{
+			MultiAppend(objects.data(), (int)objects.size());
+		}
+
+		/// <summary>
+		/// Makes sure the array can hold at least the wanted amount of objects without growing
+		/// </summary>
+		/// <param name="size">- amount of objects the array should be able to hold</param>
+		void Reserve(const int& size)
+		{
+			if (size > ArraySize)
+				Resize(size);
+		}
+
+		/// <summary>
+		/// Shrinks the array so it is only as big as the amount of objects in it
+		/// </summary>
+		void ShrinkToFit()
+		{
+			if (ArraySize > ArrayIndexPointer)
+				Resize(ArrayIndexPointer);
+		}
+
+		/// <summary>
+		/// Replaces a a chosen positin with the chosen Object
+		/// </summary>
+		/// <param name="ReplaceObject"> - Object to place in the position</param>
+		/// <param name="position"> - position to put the Object in</param>
+		void Replace(const ArrayDataType& replaceObject, const int& position)
+		{
+			if (position >= ArrayIndexPointer || position < 0)// check if the position to remove is in array range
+			{
+				throw std::out_of_range("position was out of range of the array");
+				return;
+			}
+
+			MainArray[position] = replaceObject;
+		}
+
+		/// <summary>
+		/// Remove and move all Object infront, back 1 spot
+		/// </summary>
+		/// <param name="position"> - Position to remove</param>
+		void Remove(const int& position)
+		{
+			if (position >= ArrayIndexPointer || position < 0)// check if the position to remove is in array range
+			{
+				throw std::out_of_range("position was out of range of the array");
+				return;
+			}
+
+			for (int i = position; i < (ArrayIndexPointer - 1); i++) // moving all back
+			{
+				MainArray[i] = std::move(MainArray[i + 1]);
+			}
+			std::destroy_at(&MainArray[ArrayIndexPointer - 1]); // destroy the last (now moved from) object
+			ArrayIndexPointer--;
+		}
+
+		/// <summary>
+		/// Remove by moving the last Object into the position. O(1) but doesn't keep the order
+		/// </summary>
+		/// <param name="position">- Position to remove</param>
+		void SwapRemove(const int& position)
+		{
+			if (position >= ArrayIndexPointer || position < 0)// check if the position to remove is in array range
+			{
+				throw std::out_of_range("position was out of range of the array");
+				return;
+			}
+
+			if (position != ArrayIndexPointer - 1)
+				MainArray[position] = std::move(MainArray[ArrayIndexPointer - 1]);
+
+			std::destroy_at(&MainArray[ArrayIndexPointer - 1]);
+			ArrayIndexPointer--;
+		}
+
+		/// <summary>
+		/// Remove all Objects from first up to (not including) last, everything after gets moved back in a single pass
+		/// </summary>
+		/// <param name="first">- first position to remove</param>
+		/// <param name="last">- position after the last one to remove</param>
+		void RemoveRange(const int& first, const int& last)
+		{
+			if (first < 0 || last > ArrayIndexPointer || first > last)// check if the range is in array range
+			{
+				throw std::out_of_range("range was out of range of the array");
+				return;
+			}
+
+			ArrayDataType* newEnd = std::move(MainArray + last, MainArray + ArrayIndexPointer, MainArray + first);
+			std::destroy(newEnd, MainArray + ArrayIndexPointer);
+			ArrayIndexPointer -= (last - first);
+		}
+
+		/// <summary>
+		/// Remove all Objects which the predicate returns true for, the rest get moved back in a single pass (keeps the order)
+		/// </summary>
+		/// <typeparam name="Predicate">- callable type</typeparam>
+		/// <param name="predicate">- callable which takes in an Object and returns if it should be removed</param>
+		/// <returns>amount of Objects removed</returns>
+		template<typename Predicate>
+		int RemoveIf(Predicate predicate)
+		{
+			ArrayDataType* newEnd = std::remove_if(MainArray, MainArray + ArrayIndexPointer, predicate);
+			int removedCount = (int)((MainArray + ArrayIndexPointer) - newEnd);
+
+			std::destroy(newEnd, MainArray + ArrayIndexPointer);
+			ArrayIndexPointer -= removedCount;
+			return removedCount;
+		}
+
+		/// <summary>
+		/// Clear the dynamic array. destroys all objects but keeps the current size so a reused array doesn't have to grow again
+		/// </summary>
+		void Clear()
+		{
+			std::destroy(MainArray, MainArray + ArrayIndexPointer);
+			ArrayIndexPointer = 0;
+		}
+
+		/// <summary>
+		/// Reset the dynamic array to the original size. destroys all objects and gives the memory back
+		/// </summary>
+		void Reset()
+		{
+			Clear();
+
+			if (ArraySize != ArrayDefaultSize)
+			{
+				DeallocateArray(MainArray, ArraySize);
+				MainArray = AllocateArray(ArrayDefaultSize);
+				ArraySize = ArrayDefaultSize;
+			}
+		}
+	#pragma endregion
+
+	#pragma region Variable Returns
+		/// <summary>
+		/// Return array contained in the object
+		/// </summary>
+		/// <returns>Object array</returns>
+		ArrayDataType* GetArray()
+		{
+			return MainArray;
+		}
+
+		const ArrayDataType* GetArray() const
+		{
+			return MainArray;
+		}
+
+		/// <summary>
+		/// Get a view of the objects (no copy, only valid until the array reallocates)
+		/// </summary>
+		/// <returns>span over the objects</returns>
+		std::span<ArrayDataType> AsSpan()
+		{
+			return std::span<ArrayDataType>(MainArray, ArrayIndexPointer);
+		}
+
+		std::span<const ArrayDataType> AsSpan() const
+		{
+			return std::span<const ArrayDataType>(MainArray, ArrayIndexPointer);
+		}
+
+		/// <summary>
+		/// Get a string view of the characters (no copy, only valid until the array reallocates). only for character arrays
+		/// </summary>
+		/// <returns>string view over the characters</returns>
+		std::basic_string_view<ArrayDataType> AsStringView() const requires DynamicArrayUtilities::IsCharType<ArrayDataType>
+		{
+			return std::basic_string_view<ArrayDataType>(MainArray, ArrayIndexPointer);
+		}
+
+		/// <summary>
+		/// Returns the max array size (won't be the current index)
+		/// </summary>
+		/// <returns>int of current array size</returns>
+		int GetArraySize() const
+		{
+			return ArraySize;
+		}
+
+		/// <summary>
+		/// Returns the starting size and the size it will return to when resetting
+		/// </summary>
+		/// <returns>int of starting size and the size it will return to when resetting</returns>
+		int GetArrayDefaultSize() const
+		{
+			return ArrayDefaultSize;
+		}
+
+		/// <summary>
+		/// Returns the current index/amount of objects in the array
+		/// </summary>
+		/// <returns>index/amount of objects in array</returns>
+		int GetArrayIndexPointer() const
+		{
+			return ArrayIndexPointer;
+		}
+
+		/// <summary>
+		/// Returns the steps size
+		/// </summary>
+		/// <returns>step size</returns>
+		int GetArrayStepSize() const
+		{
+			return ArrayStepSize;
+		}
+
+		/// <summary>
+		/// Returns the resize mode
+		/// </summary>
+		/// <returns>resize mode</returns>
+		ResizeMode GetResizeMode() const
+		{
+			return ArrayResizeMode;
+		}
+
+		/// <summary>
+		/// Returns the allocator used for the memory
+		/// </summary>
+		/// <returns>copy of the allocator</returns>
+		Allocator GetAllocator() const
+		{
+			return ArrayAllocator;
+		}
+
+		/// <summary>
+		/// Sets the name the array gets listed as in the statistics table. does nothing unless NOSSTDLIB_DYNAMICARRAY_STATISTICS is defined
+		/// </summary>
+		/// <param name="name">- name (has to stay alive, string literals are recommended)</param>
+		void SetStatisticsName(const char* name)
+		{
+		#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+			Statistics.Name = name;
+		#endif
+		}
+
+	#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+		/// <summary>
+		/// Gets the growth statistics of this array
+		/// </summary>
+		/// <returns>statistics</returns>
+		const DynamicArrayStatistics& GetStatistics() const
+		{
+			return Statistics;
+		}
+	#endif
+	#pragma endregion
+
+	#pragma region Resizing
+	private:
+		/// <summary>
+		/// Calculates the next array size depending on the resize mode
+		/// </summary>
+		/// <param name="minimumSize">- the smallest size the array needs to be able to hold</param>
+		/// <returns>the new array size</returns>
+		int CalculateNewSize(const int& minimumSize)
+		{
+			long long newSize; /* long long so the calculations can't overflow before getting clamped */
+
+			switch (ArrayResizeMode)
+			{
+			case DoubleMode:
+				newSize = (long long)ArraySize * 2;
+				break;
+			case OneAndHalfMode:
+				newSize = (long long)ArraySize + (ArraySize / 2);
+				break;
+			case CustomMode:
+				newSize = (ArrayResizeFunction ? ArrayResizeFunction(ArraySize) : ArraySize + ArrayStepSize);
+				break;
+			case StepMode:
+			default:
+				newSize = (long long)ArraySize + ArrayStepSize;
+				break;
+			}
+
+			/* WARNING: a step size of 0 (or a custom function which doesn't grow) would never fit the new object, so always grow by at least 1 */
+			if (newSize <= ArraySize)
+				newSize = (long long)ArraySize + 1;
+
+			if (newSize < minimumSize)
+				newSize = minimumSize;
+
+			return (int)(newSize > INT_MAX ? INT_MAX : newSize);
+		}
+
+		/// <summary>
+		/// Moves all the objects into a new array with the new size. Each object only gets moved once
+		/// </summary>
+		/// <param name="newSize">- the new array size</param>
+		void Resize(const int& newSize)
+		{
+			ReplaceMainArray(AllocateArray(newSize), newSize);
+		}
+
+		/// <summary>
+		/// Relocates all the objects into newArray, frees the old array and makes newArray the MainArray.
+		/// if relocating throws, newArray gets freed and the array stays as it was
+		/// </summary>
+		/// <param name="newArray">- the array (raw memory) to move to</param>
+		/// <param name="newSize">- size of newArray</param>
+		void ReplaceMainArray(ArrayDataType* newArray, const int& newSize)
+		{
+			try
+			{
+				DynamicArrayUtilities::RelocateObjects(MainArray, newArray, ArrayIndexPointer);
+			}
+			catch (...)
+			{
+				DeallocateArray(newArray, newSize);
+				throw;
+			}
+			AdoptArray(newArray, newSize);
+		}
+
+		/// <summary>
+		/// Frees the old array and makes newArray (which already holds the objects) the MainArray
+		/// </summary>
+		/// <param name="newArray">- the array the objects got relocated to</param>
+		/// <param name="newSize">- size of newArray</param>
+		void AdoptArray(ArrayDataType* newArray, const int& newSize)
+		{
+		#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+			Statistics.RecordResize(ArrayIndexPointer, newSize);
+		#endif
+			DeallocateArray(MainArray, ArraySize);
+			MainArray = newArray;
+			ArraySize = newSize;
+		}
+
+		/// <summary>
+		/// Allocates raw memory for the array without constructing any objects
+		/// </summary>
+		/// <param name="size">- amount of objects the memory should be able to hold</param>
+		/// <returns>pointer to the raw memory</returns>
+		ArrayDataType* AllocateArray(const int& size)
+		{
+			return std::allocator_traits<Allocator>::allocate(ArrayAllocator, size);
+		}
+
+		/// <summary>
+		/// Frees memory allocated with AllocateArray. doesn't destroy any objects
+		/// </summary>
+		/// <param name="array">- pointer to the raw memory</param>
+		/// <param name="size">- size it was allocated with</param>
+		void DeallocateArray(ArrayDataType* array, const int& size)
+		{
+			if (array != nullptr) /* moved from arrays don't have memory */
+				std::allocator_traits<Allocator>::deallocate(ArrayAllocator, array, size);
+		}
+
+		/// <summary>
+		/// Copies the size and resize settings (not the objects) from another array
+		/// </summary>
+		/// <param name="other">- array to copy the settings from</param>
+		void CopySettings(const DynamicArray& other)
+		{
+			ArrayDefaultSize = other.ArrayDefaultSize;
+			ArrayStepSize = other.ArrayStepSize;
+			ArrayResizeMode = other.ArrayResizeMode;
+			ArrayResizeFunction = other.ArrayResizeFunction;
+		#ifdef NOSSTDLIB_DYNAMICARRAY_STATISTICS
+			Statistics.Name = other.Statistics.Name;
+		#endif
+		}
+
+		/// <summary>
+		/// Takes the array from another object without touching the objects. the other object is left empty without memory
+		/// WARNING: the current MainArray has to be freed before calling this
+		/// </summary>
+		/// <param name="other">- array to steal from</param>
+		void StealArray(DynamicArray& other)
+		{
+			MainArray = other.MainArray;
+			ArraySize = other.ArraySize;
+			ArrayIndexPointer = other.ArrayIndexPointer;
+
+			other.MainArray = nullptr;
+			other.ArraySize = 0;
+			other.ArrayIndexPointer = 0;
+		}
+	public:
+	#pragma endregion
+
+	#pragma region Algorithms
+		/// <summary>
+		/// Finds the first position of the value (vectorized for int, float and double)
+		/// </summary>
+		/// <param name="value">- value to look for</param>
+		/// <returns>position of the value or -1 if it wasn't found</returns>
+		int Find(const ArrayDataType& value) const
+		{
+			return DynamicArrayKernels::Find(MainArray, ArrayIndexPointer, value);
+		}
+
+		/// <summary>
+		/// Counts how many times the value is in the array (vectorized for int, float and double)
+		/// </summary>
+		/// <param name="value">- value to count</param>
+		/// <returns>amount of times the value was found</returns>
+		int Count(const ArrayDataType& value) const
+		{
+			return DynamicArrayKernels::Count(MainArray, ArrayIndexPointer, value);
+		}
+
+		/// <summary>
+		/// Checks if the value is in the array
+		/// </summary>
+		/// <param name="value">- value to look for</param>
+		/// <returns>if the value was found</returns>
+		bool Contains(const ArrayDataType& value) const
+		{
+			return Find(value) != -1;
+		}
+
+		/// <summary>
+		/// Adds all the objects together (vectorized for int, float and double). integers get summed as 64 bit and floats as double
+		/// </summary>
+		/// <returns>sum of all the objects</returns>
+		DynamicArrayKernels::SumType<ArrayDataType> Sum() const
+		{
+			return DynamicArrayKernels::Sum(MainArray, ArrayIndexPointer);
+		}
+
+		/// <summary>
+		/// Finds the smallest object (vectorized for int, float and double)
+		/// </summary>
+		/// <returns>smallest object</returns>
+		ArrayDataType Min() const
+		{
+			return MinMax().first;
+		}
+
+		/// <summary>
+		/// Finds the biggest object (vectorized for int, float and double)
+		/// </summary>
+		/// <returns>biggest object</returns>
+		ArrayDataType Max() const
+		{
+			return MinMax().second;
+		}
+
+		/// <summary>
+		/// Finds the smallest and biggest object in one pass (vectorized for int, float and double)
+		/// </summary>
+		/// <returns>pair of (smallest, biggest)</returns>
+		std::pair<ArrayDataType, ArrayDataType> MinMax() const
+		{
+			if (ArrayIndexPointer == 0)
+			{
+				throw std::out_of_range("array is empty");
+			}
+
+			return DynamicArrayKernels::MinMax(MainArray, ArrayIndexPointer);
+		}
+	#pragma endregion
+
+	#pragma region Parallel Algorithms
+		/// <summary>
+		/// Sorts the array (smallest to biggest)
+		/// </summary>
+		/// <param name="policy">(default = Sequential) - if the sort should be split over the global thread pool</param>
+		void Sort(const ExecutionPolicy& policy = Sequential)
+		{
+			Sort(std::less<>(), policy);
+		}
+
+		/// <summary>
+		/// Sorts the array with a custom compare function.
+		/// Parallel sorts every chunk on its own thread and then merges the chunks together in pairs
+		/// </summary>
+		/// <typeparam name="Compare">- compare function type</typeparam>
+		/// <param name="compare">- function which returns if the first argument should go before the second</param>
+		/// <param name="policy">(default = Sequential) - if the sort should be split over the global thread pool</param>
+		template<class Compare>
+		void Sort(Compare compare, const ExecutionPolicy& policy = Sequential)
+		{
+			ChunkedSort(policy, [&compare](ArrayDataType* first, ArrayDataType* last) { std::sort(first, last, compare); }, compare);
+		}
+
+		/// <summary>
+		/// Sorts the array while keeping the order of equal objects
+		/// </summary>
+		/// <param name="policy">(default = Sequential) - if the sort should be split over the global thread pool</param>
+		void StableSort(const ExecutionPolicy& policy = Sequential)
+		{
+			StableSort(std::less<>(), policy);
+		}
+
+		/// <summary>
+		/// Sorts the array with a custom compare function while keeping the order of equal objects
+		/// </summary>
+		/// <typeparam name="Compare">- compare function type</typeparam>
+		/// <param name="compare">- function which returns if the first argument should go before the second</param>
+		/// <param name="policy">(default = Sequential) - if the sort should be split over the global thread pool</param>
+		template<class Compare>
+		void StableSort(Compare compare, const ExecutionPolicy& policy = Sequential)
+		{
+			ChunkedSort(policy, [&compare](ArrayDataType* first, ArrayDataType* last) { std::stable_sort(first, last, compare); }, compare);
+		}
+
+		/// <summary>
+		/// Replaces every object with the result of the function (object = function(object))
+		/// </summary>
+		/// <typeparam name="Function">- function type</typeparam>
+		/// <param name="function">- function which takes an object and returns the new object</param>
+		/// <param name="policy">(default = Sequential) - if the work should be split over the global thread pool</param>
+		template<class Function>
+		void Transform(Function function, const ExecutionPolicy& policy = Sequential)
+		{
+			RunChunks(policy, [&function](ArrayDataType* first, ArrayDataType* last)
+			{
+				for (; first != last; first++)
+				{
+					*first = function(*first);
+				}
+			});
+		}
+
+		/// <summary>
+		/// Runs the function on every object.
+		/// WARNING: with Parallel the function gets called from multiple threads at once
+		/// </summary>
+		/// <typeparam name="Function">- function type</typeparam>
+		/// <param name="function">- function which takes a reference to the object</param>
+		/// <param name="policy">(default = Sequential) - if the work should be split over the global thread pool</param>
+		template<class Function>
+		void ForEach(Function function, const ExecutionPolicy& policy = Sequential)
+		{
+			RunChunks(policy, [&function](ArrayDataType* first, ArrayDataType* last) { std::for_each(first, last, function); });
+		}
+	private:
+		/// <summary>
+		/// smallest amount of objects a chunk gets, below this the threading costs more then it saves
+		/// </summary>
+		static constexpr int MinimumParallelChunk = 16384;
+
+		/// <summary>
+		/// Splits the array into cache line aligned chunks and runs chunkFunction(first, last) on each of them
+		/// </summary>
+		/// <param name="policy">- Sequential runs a single chunk on the calling thread</param>
+		/// <param name="chunkFunction">- function which takes the range of the chunk</param>
+		/// <returns>the chunk boundaries which were used</returns>
+		template<class ChunkFunction>
+		std::vector<int> RunChunks(const ExecutionPolicy& policy, ChunkFunction chunkFunction)
+		{
+			if (policy == Sequential || ArrayIndexPointer < MinimumParallelChunk * 2)
+			{
+				chunkFunction(MainArray, MainArray + ArrayIndexPointer);
+				return { 0, ArrayIndexPointer };
+			}
+
+			Threading::ThreadPool& pool = Threading::ThreadPool::GetGlobal();
+			std::vector<int> boundaries = Threading::SplitIntoChunks(MainArray, ArrayIndexPointer, pool.GetThreadCount(), MinimumParallelChunk);
+			pool.RunTasks((int)boundaries.size() - 1, [&](int chunk)
+			{
+				chunkFunction(MainArray + boundaries[chunk], MainArray + boundaries[chunk + 1]);
+			});
+			return boundaries;
+		}
+
+		/// <summary>
+		/// Sorts every chunk with sortFunction and then merges neighbouring chunks in rounds until one is left (every merge in a round runs in parallel)
+		/// </summary>
+		template<class SortFunction, class Compare>
+		void ChunkedSort(const ExecutionPolicy& policy, SortFunction sortFunction, Compare& compare)
+		{
+			std::vector<int> boundaries = RunChunks(policy, sortFunction);
+
+			while (boundaries.size() > 2)
+			{
+				int mergeCount = (int)(boundaries.size() - 1) / 2;
+				Threading::ThreadPool::GetGlobal().RunTasks(mergeCount, [&](int merge)
+				{
+					std::inplace_merge(MainArray + boundaries[merge * 2], MainArray + boundaries[merge * 2 + 1], MainArray + boundaries[merge * 2 + 2], compare);
+				});
+
+				std::vector<int> mergedBoundaries;
+				for (int i = 0; i < (int)boundaries.size(); i += 2) /* drop every odd boundary, the last one always stays */
+				{
+					mergedBoundaries.push_back(boundaries[i]);
+				}
+				if (mergedBoundaries.back() != boundaries.back())
+				{
+					mergedBoundaries.push_back(boundaries.back());
+				}
+				boundaries = std::move(mergedBoundaries);
+			}
+		}
+	public:
+	#pragma endregion
+
+	#pragma region For Loop Functions
+		// For loop range-based function
+		iterator begin() { return MainArray; }
+		const_iterator begin() const { return MainArray; }
+		iterator end() { return MainArray + ArrayIndexPointer; }
+		const_iterator end() const { return MainArray + ArrayIndexPointer; }
+	#pragma endregion
+
+	#pragma region Operators
+		/// <summary>
+		/// Copy assignment, reuses the current memory if the objects fit
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		/// <returns>self</returns>
+		DynamicArray& operator=(const DynamicArray& other)
+		{
+			if (this == &other)
+				return *this;
+
+			Clear();
+
+			if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+			{
+				if (ArrayAllocator != other.ArrayAllocator) /* memory has to be given back to the allocator which allocated it */
+				{
+					DeallocateArray(MainArray, ArraySize);
+					MainArray = nullptr;
+					ArraySize = 0;
+				}
+				ArrayAllocator = other.ArrayAllocator;
+			}
+
+			if (ArraySize < other.ArrayIndexPointer)
+			{
+				ArrayDataType* NewArray = AllocateArray(other.ArrayIndexPointer); /* allocated first so MainArray never points at freed memory if this throws */
+				DeallocateArray(MainArray, ArraySize);
+				MainArray = NewArray;
+				ArraySize = other.ArrayIndexPointer;
+			}
+
+			CopySettings(other);
+			std::uninitialized_copy(other.MainArray, other.MainArray + other.ArrayIndexPointer, MainArray);
+			ArrayIndexPointer = other.ArrayIndexPointer;
+			return *this;
+		}
+
+		/// <summary>
+		/// Move assignment, steals the array in O(1) (if both use different memory resources, the objects get moved one by one instead)
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		/// <returns>self</returns>
+		DynamicArray& operator=(DynamicArray&& other) noexcept(std::allocator_traits<Allocator>::is_always_equal::value || std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
+		{
+			if (this == &other)
+				return *this;
+
+			Clear();
+			CopySettings(other);
+
+			if (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value || ArrayAllocator == other.ArrayAllocator)
+			{
+				DeallocateArray(MainArray, ArraySize);
+				if constexpr (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
+					ArrayAllocator = std::move(other.ArrayAllocator);
+				StealArray(other);
+			}
+			else
+			{
+				Reserve(other.ArrayIndexPointer);
+				std::uninitialized_move(other.MainArray, other.MainArray + other.ArrayIndexPointer, MainArray);
+				ArrayIndexPointer = other.ArrayIndexPointer;
+				other.Clear();
+			}
+			return *this;
+		}
+
+		/// <summary>
+		/// What to do incase of << operator with wostream
+		/// </summary>
+		/// <param name="os">- output stream</param>
+		/// <param name="Array">- the array object</param>
+		/// <returns></returns>
+		friend std::wostream& operator<<(std::wostream& os, const DynamicArray& MainArray) /* TODO: make wostream and ostream be 1 function which uses std::basic_stream */
+		{
+			if constexpr (std::is_same<ArrayDataType, wchar_t>::value) /* if the array contained is wchar. output as text (MainArray isn't null terminated, so the view length decides how much gets written) */
+			{
+				os << MainArray.AsStringView();
+			}
+			else  /* if type is any other "list" the array with comman */
+			{
+				for (int i = 0; i < MainArray.ArrayIndexPointer; i++)
+				{
+					os << MainArray.MainArray[i];
+
+					if (!(i == MainArray.ArrayIndexPointer - 1))
+					{
+						os << ", ";
+					}
+				}
+			}
+			return os;
+		}
+
+		/// <summary>
+		/// What to do incase of << operator with ostream
+		/// </summary>
+		/// <param name="os">- output stream</param>
+		/// <param name="Array">- the array object</param>
+		/// <returns></returns>
+		friend std::ostream& operator<<(std::ostream& os, const DynamicArray& MainArray)
+		{
+			if constexpr (std::is_same<ArrayDataType, char>::value) /* if the array contained is char. output as text (MainArray isn't null terminated, so the view length decides how much gets written) */
+			{
+				os << MainArray.AsStringView();
+			}
+			else  /* if type is any other "list" the array with comman */
+			{
+				for (int i = 0; i < MainArray.ArrayIndexPointer; i++)
+				{
+					os << MainArray.MainArray[i];
+
+					if (!(i == MainArray.ArrayIndexPointer - 1))
+					{
+						os << ", ";
+					}
+				}
+			}
+			return os;
+		}
+
+		/// <summary>
+		/// allows passing the array to anything which takes a std::span without copying
+		/// </summary>
+		operator std::span<ArrayDataType>() { return AsSpan(); }
+		operator std::span<const ArrayDataType>() const { return AsSpan(); }
+
+		/// <summary>
+		/// allows passing character arrays to anything which takes a std::basic_string_view without copying
+		/// </summary>
+		operator std::basic_string_view<ArrayDataType>() const requires DynamicArrayUtilities::IsCharType<ArrayDataType> { return AsStringView(); }
+
+		/// <summary>
+		/// [] operator which acts the same as the Array [] operator
+		/// </summary>
+		/// <param name="position">- position of the value wanted</param>
+		/// <returns>value in the position</returns>
+		ArrayDataType& operator[](const int& position)
+		{
+			return MainArray[position];
+		}
+
+		const ArrayDataType& operator[](const int& position) const
+		{
+			return MainArray[position];
+		}
+
+		/// <summary>
+		/// Inserts object into self
+		/// </summary>
+		/// <param name="insersationObject">- the object to insert</param>
+		/// <returns>combined objects</returns>
+		DynamicArray& operator<<(const DynamicArray& insersationObject)
+		{
+			this->MultiAppend(insersationObject.begin(), insersationObject.end());
+			return *this;
+		}
+
+		/// <summary>
+		/// Inserts object into self
+		/// </summary>
+		/// <param name="insersationObject">- the object to insert</param>
+		/// <returns>combined objects</returns>
+		DynamicArray& operator+=(const DynamicArray& insersationObject)
+		{
+			this->MultiAppend(insersationObject.begin(), insersationObject.end());
+			return *this;
+		}
+	#pragma endregion
+	};
+
+	/// <summary>
+	/// DynamicArray which gets its memory from a std::pmr::memory_resource (such as NosStdLib::Memory::ArenaResource).
+	/// example: `NosStdLib::PmrDynamicArray<int> array(&arena);`
+	/// </summary>
+	/// <typeparam name="ArrayDataType">- datatype for the array</typeparam>
+	template<class ArrayDataType>
+	using PmrDynamicArray = DynamicArray<ArrayDataType, std::pmr::polymorphic_allocator<ArrayDataType>>;
+
+	/// <summary>
+	/// DynamicArray which stores the first InlineSize objects inside of itself and only allocates on the heap once it gets bigger.
+	/// meant for arrays which usually stay tiny (such as children lists in trees)
+	/// </summary>
+	/// <typeparam name="ArrayDataType">- datatype for the array</typeparam>
+	/// <typeparam name="InlineSize">- amount of objects which can get stored without allocating</typeparam>
+	template<class ArrayDataType, int InlineSize>
+	class SmallDynamicArray
+	{
+	private:
+		static_assert(InlineSize > 0, "InlineSize has to be bigger then 0");
+
+		alignas(ArrayDataType) unsigned char InlineArray[sizeof(ArrayDataType) * InlineSize];	/* Inline raw storage used until the array overflows */
+		ArrayDataType* MainArray;	/* Pointer to Array (either InlineArray or heap memory) */
+		int ArraySize;				/* current max amount of objects */
+		int ArrayIndexPointer;		/* keeps track amount of objects in array */
+
+		typedef ArrayDataType* iterator;
+		typedef const ArrayDataType* const_iterator;
+	public:
+	#pragma region Constructors
+		/// <summary>
+		/// Constructor which makes the array use the inline storage
+		/// </summary>
+		SmallDynamicArray()
+		{
+			MainArray = GetInlineArray();
+			ArraySize = InlineSize;
+			ArrayIndexPointer = 0;
+		}
+
+		/// <summary>
+		/// Copy constructor, copies all the objects (only allocates if they don't fit inline)
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		SmallDynamicArray(const SmallDynamicArray& other) : SmallDynamicArray()
+		{
+			MultiAppend(other.MainArray, other.ArrayIndexPointer);
+		}
+
+		/// <summary>
+		/// Move constructor, steals the heap memory or moves the inline objects
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<ArrayDataType>) : SmallDynamicArray()
+		{
+			TakeObjects(other);
+		}
+
+		/// Destroy objects and free heap memory if it was used
+		~SmallDynamicArray()
+		{
+			std::destroy(MainArray, MainArray + ArrayIndexPointer);
+			if (!IsInline())
+				std::allocator<ArrayDataType>().deallocate(MainArray, ArraySize);
+		}
+	#pragma endregion
+
+	#pragma region MainArray Modification
+		/// <summary>
+		/// Construct an Object in place at the end of the array
+		/// </summary>
+		/// <typeparam name="...VariadicArgs">- the constructor parameter types</typeparam>
+		/// <param name="...args">- the constructor parameters</param>
+		/// <returns>reference to the constructed Object</returns>
+		template<typename ... VariadicArgs>
+		ArrayDataType& EmplaceAppend(VariadicArgs&& ... args)
+		{
+			if (ArrayIndexPointer >= ArraySize)
+			{
+				int newSize = ArraySize * 2;
+				ArrayDataType* NewArray = std::allocator<ArrayDataType>().allocate(newSize);
+
+				try
+				{
+					DynamicArrayUtilities::EmplaceAndRelocate(MainArray, NewArray, ArrayIndexPointer, std::forward<VariadicArgs>(args)...);
+				}
+				catch (...)
+				{
+					std::allocator<ArrayDataType>().deallocate(NewArray, newSize);
+					throw;
+				}
+				AdoptArray(NewArray, newSize);
+			}
+			else
+			{
+				new (&MainArray[ArrayIndexPointer]) ArrayDataType(std::forward<VariadicArgs>(args)...);
+			}
+
+			return MainArray[ArrayIndexPointer++];
+		}
+
+		/// <summary>
+		/// Append single Object
+		/// </summary>
+		/// <param name="objectToAdd">- Object to add</param>
+		void Append(const ArrayDataType& objectToAdd)
+		{
+			EmplaceAppend(objectToAdd);
+		}
+
+		/// <summary>
+		/// Append single Object by moving it
+		/// </summary>
+		/// <param name="objectToAdd">- Object to move in</param>
+		void Append(ArrayDataType&& objectToAdd)
+		{
+			EmplaceAppend(std::move(objectToAdd));
+		}
+
+		/// <summary>
+		/// Adds from the beginning address to the range to the end of current array. Grows at most once
+		/// </summary>
+		/// <param name="beginning">- the beginning address</param>
+		/// <param name="range">- the range of items wanted</param>
+		void MultiAppend(const ArrayDataType* beginning, const int& range)
+		{
+			if (range <= 0)
+				return;
+
+			if (ArrayIndexPointer + range > ArraySize)
+			{
+				/* if the objects are inside of MainArray (appending to self), they get moved with the resize so find them again after */
+				bool insideSelf = (beginning >= MainArray && beginning < MainArray + ArrayIndexPointer);
+				ptrdiff_t selfOffset = beginning - MainArray;
+
+				Reserve((ArraySize * 2 > ArrayIndexPointer + range) ? ArraySize * 2 : ArrayIndexPointer + range);
+
+				if (insideSelf)
+					beginning = MainArray + selfOffset;
+			}
+
+			std::uninitialized_copy(beginning, beginning + range, MainArray + ArrayIndexPointer);
+			ArrayIndexPointer += range;
+		}
+
+		/// <summary>
+		/// Makes sure the array can hold at least the wanted amount of objects without growing
+		/// </summary>
+		/// <param name="size">- amount of objects the array should be able to hold</param>
+		void Reserve(const int& size)
+		{
+			if (size > ArraySize)
+				ReplaceMainArray(std::allocator<ArrayDataType>().allocate(size), size);
+		}
+
+		/// <summary>
+		/// Remove and move all Object infront, back 1 spot
+		/// </summary>
+		/// <param name="position">- Position to remove</param>
+		void Remove(const int& position)
+		{
+			if (position >= ArrayIndexPointer || position < 0)// check if the position to remove is in array range
+			{
+				throw std::out_of_range("position was out of range of the array");
+				return;
+			}
+
+			std::move(MainArray + position + 1, MainArray + ArrayIndexPointer, MainArray + position);
+			std::destroy_at(&MainArray[ArrayIndexPointer - 1]);
+			ArrayIndexPointer--;
+		}
+
+		/// <summary>
+		/// Destroys all the objects, keeps the memory
+		/// </summary>
+		void Clear()
+		{
+			std::destroy(MainArray, MainArray + ArrayIndexPointer);
+			ArrayIndexPointer = 0;
+		}
+	#pragma endregion
+
+	#pragma region Variable Returns
+		/// <summary>
+		/// Return array contained in the object
+		/// </summary>
+		/// <returns>Object array</returns>
+		ArrayDataType* GetArray()
+		{
+			return MainArray;
+		}
+
+		/// <summary>
+		/// Get a view of the objects (no copy, only valid until the array reallocates)
+		/// </summary>
+		/// <returns>span over the objects</returns>
+		std::span<ArrayDataType> AsSpan()
+		{
+			return std::span<ArrayDataType>(MainArray, ArrayIndexPointer);
+		}
+
+		std::span<const ArrayDataType> AsSpan() const
+		{
+			return std::span<const ArrayDataType>(MainArray, ArrayIndexPointer);
+		}
+
+		/// <summary>
+		/// Returns the max array size (won't be the current index)
+		/// </summary>
+		/// <returns>int of current array size</returns>
+		int GetArraySize() const
+		{
+			return ArraySize;
+		}
+
+		/// <summary>
+		/// Returns the current index/amount of objects in the array
+		/// </summary>
+		/// <returns>index/amount of objects in array</returns>
+		int GetArrayIndexPointer() const
+		{
+			return ArrayIndexPointer;
+		}
+
+		/// <summary>
+		/// Returns if the objects are still stored inline (no heap memory used)
+		/// </summary>
+		/// <returns>if the array is inline</returns>
+		bool IsInline() const
+		{
+			return MainArray == GetInlineArray();
+		}
+	#pragma endregion
+
+	private:
+		/// <summary>
+		/// Returns the inline storage as an array pointer
+		/// </summary>
+		/// <returns>pointer to the inline storage</returns>
+		ArrayDataType* GetInlineArray()
+		{
+			return reinterpret_cast<ArrayDataType*>(InlineArray); /* no std::launder, the storage can be empty and launder needs a living object at the address */
+		}
+
+		const ArrayDataType* GetInlineArray() const
+		{
+			return reinterpret_cast<const ArrayDataType*>(InlineArray);
+		}
+
+		/// <summary>
+		/// Relocates all the objects into newArray (heap memory), frees the old heap memory if there was any and makes newArray the MainArray.
+		/// if relocating throws, newArray gets freed and the array stays as it was
+		/// </summary>
+		/// <param name="newArray">- the array (raw memory) to move to</param>
+		/// <param name="newSize">- size of newArray</param>
+		void ReplaceMainArray(ArrayDataType* newArray, const int& newSize)
+		{
+			try
+			{
+				DynamicArrayUtilities::RelocateObjects(MainArray, newArray, ArrayIndexPointer);
+			}
+			catch (...)
+			{
+				std::allocator<ArrayDataType>().deallocate(newArray, newSize);
+				throw;
+			}
+			AdoptArray(newArray, newSize);
+		}
+
+		/// <summary>
+		/// Frees the old heap memory if there was any and makes newArray (which already holds the objects) the MainArray
+		/// </summary>
+		/// <param name="newArray">- the array the objects got relocated to</param>
+		/// <param name="newSize">- size of newArray</param>
+		void AdoptArray(ArrayDataType* newArray, const int& newSize)
+		{
+			if (!IsInline())
+				std::allocator<ArrayDataType>().deallocate(MainArray, ArraySize);
+			MainArray = newArray;
+			ArraySize = newSize;
+		}
+
+		/// <summary>
+		/// Takes all the objects from another (empty and inline) array. heap memory gets stolen, inline objects get moved
+		/// </summary>
+		/// <param name="other">- array to take from</param>
+		void TakeObjects(SmallDynamicArray& other)
+		{
+			if (other.IsInline())
+			{
+				DynamicArrayUtilities::RelocateObjects(other.MainArray, MainArray, other.ArrayIndexPointer);
+			}
+			else
+			{
+				MainArray = other.MainArray;
+				ArraySize = other.ArraySize;
+				other.MainArray = other.GetInlineArray();
+				other.ArraySize = InlineSize;
+			}
+
+			ArrayIndexPointer = other.ArrayIndexPointer;
+			other.ArrayIndexPointer = 0;
+		}
+	public:
+
+	#pragma region For Loop Functions
+		// For loop range-based function
+		iterator begin() { return &MainArray[0]; }
+		const_iterator begin() const { return &MainArray[0]; }
+		iterator end() { return &MainArray[ArrayIndexPointer]; }
+		const_iterator end() const { return &MainArray[ArrayIndexPointer]; }
+	#pragma endregion
+
+	#pragma region Operators
+		/// <summary>
+		/// [] operator which acts the same as the Array [] operator
+		/// </summary>
+		/// <param name="position">- position of the value wanted</param>
+		/// <returns>value in the position</returns>
+		ArrayDataType& operator[](const int& position)
+		{
+			return MainArray[position];
+		}
+
+		const ArrayDataType& operator[](const int& position) const
+		{
+			return MainArray[position];
+		}
+
+		/// <summary>
+		/// Copy assignment, reuses the current memory if the objects fit
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		/// <returns>self</returns>
+		SmallDynamicArray& operator=(const SmallDynamicArray& other)
+		{
+			if (this != &other)
+			{
+				Clear();
+				MultiAppend(other.MainArray, other.ArrayIndexPointer);
+			}
+			return *this;
+		}
+
+		/// <summary>
+		/// Move assignment, steals the heap memory or moves the inline objects
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		/// <returns>self</returns>
+		SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<ArrayDataType>)
+		{
+			if (this != &other)
+			{
+				Clear();
+				if (!IsInline())
+					std::allocator<ArrayDataType>().deallocate(MainArray, ArraySize);
+				MainArray = GetInlineArray();
+				ArraySize = InlineSize;
+				TakeObjects(other);
+			}
+			return *this;
+		}
+	#pragma endregion
+	};
+
+	/// <summary>
+	/// DynamicArray which never moves its objects. objects are stored in fixed size chunks which get looked up through a chunk table,
+	/// so growing only allocates a new chunk and pointers/references to objects stay valid until the object gets removed
+	/// </summary>
+	/// <typeparam name="ArrayDataType">- datatype of the array</typeparam>
+	/// <typeparam name="ChunkSize">(default = 256) - amount of objects in each chunk (a power of 2 makes indexing cheaper)</typeparam>
+	template<class ArrayDataType, int ChunkSize = 256>
+	class StableDynamicArray
+	{
+		static_assert(ChunkSize > 0, "ChunkSize has to be bigger then 0");
+	private:
+		DynamicArray<ArrayDataType*> ChunkTable;	/* pointers to the chunks, only the table moves when it grows */
+		int ArrayIndexPointer;						/* amount of objects in the array */
+
+		/// <summary>
+		/// Allocates a new chunk and adds it to the chunk table. if the table throws while growing, the chunk gets freed
+		/// </summary>
+		void AddChunk()
+		{
+			ArrayDataType* chunk = std::allocator<ArrayDataType>().allocate(ChunkSize);
+			try
+			{
+				ChunkTable.Append(chunk);
+			}
+			catch (...)
+			{
+				std::allocator<ArrayDataType>().deallocate(chunk, ChunkSize);
+				throw;
+			}
+		}
+
+		/// <summary>
+		/// iterator over the chunks, Const picks if it gives const references
+		/// </summary>
+		template<bool Const>
+		class Iterator
+		{
+		private:
+			using TablePointer = std::conditional_t<Const, ArrayDataType* const*, ArrayDataType**>;
+
+			TablePointer Table;	/* the chunk table */
+			int Index;			/* current index */
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = ArrayDataType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, const ArrayDataType*, ArrayDataType*>;
+			using reference = std::conditional_t<Const, const ArrayDataType&, ArrayDataType&>;
+
+			Iterator() : Table(nullptr), Index(0) {}
+			Iterator(TablePointer table, const int& index) : Table(table), Index(index) {}
+
+			reference operator*() const { return Table[Index / ChunkSize][Index % ChunkSize]; }
+			pointer operator->() const { return &**this; }
+			reference operator[](const difference_type& offset) const { return *(*this + offset); }
+
+			Iterator& operator++() { Index++; return *this; }
+			Iterator operator++(int) { Iterator copy = *this; Index++; return copy; }
+			Iterator& operator--() { Index--; return *this; }
+			Iterator operator--(int) { Iterator copy = *this; Index--; return copy; }
+			Iterator& operator+=(const difference_type& offset) { Index += (int)offset; return *this; }
+			Iterator& operator-=(const difference_type& offset) { Index -= (int)offset; return *this; }
+			Iterator operator+(const difference_type& offset) const { return Iterator(Table, Index + (int)offset); }
+			Iterator operator-(const difference_type& offset) const { return Iterator(Table, Index - (int)offset); }
+			friend Iterator operator+(const difference_type& offset, const Iterator& iterator) { return iterator + offset; }
+			difference_type operator-(const Iterator& other) const { return Index - other.Index; }
+
+			bool operator==(const Iterator& other) const { return Index == other.Index; }
+			auto operator<=>(const Iterator& other) const { return Index <=> other.Index; }
+		};
+	public:
+		typedef Iterator<false> iterator;
+		typedef Iterator<true> const_iterator;
+
+	#pragma region Constructors
+		StableDynamicArray() : ChunkTable(4, 0, DoubleMode), ArrayIndexPointer(0) {}
+
+		/// <summary>
+		/// Copy constructor, copies the objects into new chunks
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		StableDynamicArray(const StableDynamicArray& other) : StableDynamicArray()
+		{
+			Reserve(other.ArrayIndexPointer);
+			for (const ArrayDataType& object : other)
+			{
+				Append(object);
+			}
+		}
+
+		/// <summary>
+		/// Move constructor, takes the chunks (pointers to the objects stay valid)
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		StableDynamicArray(StableDynamicArray&& other) noexcept : ChunkTable(std::move(other.ChunkTable)), ArrayIndexPointer(other.ArrayIndexPointer)
+		{
+			other.ArrayIndexPointer = 0;
+		}
+
+		~StableDynamicArray()
+		{
+			Reset();
+		}
+	#pragma endregion
+
+	#pragma region MainArray Modification
+		/// <summary>
+		/// Constructs an object at the end of the array. never moves the other objects
+		/// </summary>
+		/// <param name="...args">- arguments which get passed to the constructor</param>
+		/// <returns>reference to the new object</returns>
+		template<typename... VariadicArgs>
+		ArrayDataType& EmplaceAppend(VariadicArgs&&... args)
+		{
+			if (ArrayIndexPointer == GetArraySize())
+			{
+				AddChunk();
+			}
+
+			ArrayDataType* object = new (ChunkTable[ArrayIndexPointer / ChunkSize] + (ArrayIndexPointer % ChunkSize)) ArrayDataType(std::forward<VariadicArgs>(args)...);
+			ArrayIndexPointer++;
+			return *object;
+		}
+
+		/// <summary>
+		/// Append object to end of the array. never moves the other objects
+		/// </summary>
+		/// <param name="objectToAdd">- object to add</param>
+		void Append(const ArrayDataType& objectToAdd)
+		{
+			EmplaceAppend(objectToAdd);
+		}
+
+		/// <summary>
+		/// Append object to end of the array by moving it. never moves the other objects
+		/// </summary>
+		/// <param name="objectToAdd">- object to move in</param>
+		void Append(ArrayDataType&& objectToAdd)
+		{
+			EmplaceAppend(std::move(objectToAdd));
+		}
+
+		/// <summary>
+		/// Allocates enough chunks to fit the wanted amount of objects
+		/// </summary>
+		/// <param name="size">- amount of objects which should fit without allocating</param>
+		void Reserve(const int& size)
+		{
+			int chunksNeeded = (int)(((long long)size + ChunkSize - 1) / ChunkSize);
+			ChunkTable.Reserve(chunksNeeded);
+			while (ChunkTable.GetArrayIndexPointer() < chunksNeeded)
+			{
+				AddChunk();
+			}
+		}
+
+		/// <summary>
+		/// Replace an object in a position
+		/// </summary>
+		/// <param name="replaceObject">- object to replace with</param>
+		/// <param name="position">- position to replace</param>
+		void Replace(const ArrayDataType& replaceObject, const int& position)
+		{
+			if (position < 0 || position >= ArrayIndexPointer)
+			{
+				throw std::out_of_range("position was out of range");
+			}
+
+			(*this)[position] = replaceObject;
+		}
+
+		/// <summary>
+		/// Removes the last object (the only remove which doesn't move any objects)
+		/// </summary>
+		void RemoveLast()
+		{
+			if (ArrayIndexPointer == 0)
+			{
+				throw std::out_of_range("array is empty");
+			}
+
+			ArrayIndexPointer--;
+			std::destroy_at(&(*this)[ArrayIndexPointer]);
+		}
+
+		/// <summary>
+		/// Destroys all the objects but keeps the chunks, so reusing the array doesn't allocate again
+		/// </summary>
+		void Clear()
+		{
+			std::destroy(begin(), end());
+			ArrayIndexPointer = 0;
+		}
+
+		/// <summary>
+		/// Destroys all the objects and frees all the chunks
+		/// </summary>
+		void Reset()
+		{
+			Clear();
+			for (ArrayDataType* chunk : ChunkTable)
+			{
+				std::allocator<ArrayDataType>().deallocate(chunk, ChunkSize);
+			}
+			ChunkTable.Reset();
+		}
+	#pragma endregion
+
+	#pragma region Variable Returns
+		/// <summary>
+		/// Get the amount of objects which fit in the allocated chunks
+		/// </summary>
+		/// <returns>amount of chunks * ChunkSize</returns>
+		int GetArraySize() const
+		{
+			return ChunkTable.GetArrayIndexPointer() * ChunkSize;
+		}
+
+		/// <summary>
+		/// Get the amount of objects in the array
+		/// </summary>
+		/// <returns>amount of objects</returns>
+		int GetArrayIndexPointer() const
+		{
+			return ArrayIndexPointer;
+		}
+
+		/// <summary>
+		/// Get the amount of chunks allocated
+		/// </summary>
+		/// <returns>amount of chunks</returns>
+		int GetChunkCount() const
+		{
+			return ChunkTable.GetArrayIndexPointer();
+		}
+	#pragma endregion
+
+	#pragma region For Loop Functions
+		// For loop range-based function
+		iterator begin() { return iterator(ChunkTable.GetArray(), 0); }
+		const_iterator begin() const { return const_iterator(ChunkTable.GetArray(), 0); }
+		iterator end() { return iterator(ChunkTable.GetArray(), ArrayIndexPointer); }
+		const_iterator end() const { return const_iterator(ChunkTable.GetArray(), ArrayIndexPointer); }
+	#pragma endregion
+
+	#pragma region Operators
+		/// <summary>
+		/// Copy assignment, copies the objects into the chunks which are already allocated where it can
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		/// <returns>self</returns>
+		StableDynamicArray& operator=(const StableDynamicArray& other)
+		{
+			if (this != &other)
+			{
+				Clear();
+				Reserve(other.ArrayIndexPointer);
+				for (const ArrayDataType& object : other)
+				{
+					Append(object);
+				}
+			}
+			return *this;
+		}
+
+		/// <summary>
+		/// Move assignment, takes the chunks (pointers to the objects stay valid)
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		/// <returns>self</returns>
+		StableDynamicArray& operator=(StableDynamicArray&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				ChunkTable = std::move(other.ChunkTable);
+				ArrayIndexPointer = other.ArrayIndexPointer;
+				other.ArrayIndexPointer = 0;
+			}
+			return *this;
+		}
+
+		ArrayDataType& operator[](const int& position)
+		{
+			return ChunkTable[position / ChunkSize][position % ChunkSize];
+		}
+
+		const ArrayDataType& operator[](const int& position) const
+		{
+			return ChunkTable[position / ChunkSize][position % ChunkSize];
+		}
+	#pragma endregion
+	};
+
+	/// <summary>
+	/// Fixed size circular DynamicArray. once it is full, appending overwrites the oldest object, so the memory used never grows.
+	/// adding and removing at both ends is O(1). made for chat/log tails which only need the last N objects
+	/// </summary>
+	/// <typeparam name="ArrayDataType">- datatype of the array</typeparam>
+	template<class ArrayDataType>
+	class RingDynamicArray
+	{
+	private:
+		ArrayDataType* MainArray;	/* the buffer (only [Head, Head + ArrayIndexPointer) wrapped around holds objects) */
+		int ArraySize;				/* capacity of the buffer */
+		int Head;					/* physical position of the first object */
+		int ArrayIndexPointer;		/* amount of objects in the buffer */
+
+		/// <summary>
+		/// Converts a position (0 = first object) into the physical position in MainArray
+		/// </summary>
+		int PhysicalPosition(const int& position) const
+		{
+			int physical = Head + position;
+			return (physical >= ArraySize ? physical - ArraySize : physical);
+		}
+
+		/// <summary>
+		/// Creates an array without a buffer (the same state a moved from array is in). the copy constructor delegates to it so the destructor cleans up if a copy throws
+		/// </summary>
+		RingDynamicArray() : MainArray(nullptr), ArraySize(0), Head(0), ArrayIndexPointer(0) {}
+
+		/// <summary>
+		/// Throws if the array was moved from (it has no buffer to add objects into)
+		/// </summary>
+		void CheckHasBuffer() const
+		{
+			if (MainArray == nullptr)
+			{
+				throw std::logic_error("array was moved from and has no buffer");
+			}
+		}
+
+		/// <summary>
+		/// iterator over the objects in order (first to last), Const picks if it gives const references
+		/// </summary>
+		template<bool Const>
+		class Iterator
+		{
+		private:
+			using ArrayPointer = std::conditional_t<Const, const RingDynamicArray*, RingDynamicArray*>;
+
+			ArrayPointer Array;	/* array being iterated */
+			int Position;		/* current position */
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = ArrayDataType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, const ArrayDataType*, ArrayDataType*>;
+			using reference = std::conditional_t<Const, const ArrayDataType&, ArrayDataType&>;
+
+			Iterator() : Array(nullptr), Position(0) {}
+			Iterator(ArrayPointer array, const int& position) : Array(array), Position(position) {}
+
+			reference operator*() const { return (*Array)[Position]; }
+			pointer operator->() const { return &(*Array)[Position]; }
+			reference operator[](const difference_type& offset) const { return (*Array)[Position + (int)offset]; }
+
+			Iterator& operator++() { Position++; return *this; }
+			Iterator operator++(int) { Iterator copy = *this; Position++; return copy; }
+			Iterator& operator--() { Position--; return *this; }
+			Iterator operator--(int) { Iterator copy = *this; Position--; return copy; }
+			Iterator& operator+=(const difference_type& offset) { Position += (int)offset; return *this; }
+			Iterator& operator-=(const difference_type& offset) { Position -= (int)offset; return *this; }
+			Iterator operator+(const difference_type& offset) const { return Iterator(Array, Position + (int)offset); }
+			Iterator operator-(const difference_type& offset) const { return Iterator(Array, Position - (int)offset); }
+			friend Iterator operator+(const difference_type& offset, const Iterator& iterator) { return iterator + offset; }
+			difference_type operator-(const Iterator& other) const { return Position - other.Position; }
+
+			bool operator==(const Iterator& other) const { return Position == other.Position; }
+			auto operator<=>(const Iterator& other) const { return Position <=> other.Position; }
+		};
+	public:
+		typedef Iterator<false> iterator;
+		typedef Iterator<true> const_iterator;
+
+	#pragma region Constructors
+		/// <summary>
+		/// Creates the buffer
+		/// </summary>
+		/// <param name="size">- the most objects the buffer holds, the memory never grows past this</param>
+		explicit RingDynamicArray(const int& size)
+		{
+			if (size <= 0)
+			{
+				throw std::invalid_argument("size has to be bigger then 0");
+			}
+
+			ArraySize = size;
+			Head = 0;
+			ArrayIndexPointer = 0;
+			MainArray = std::allocator<ArrayDataType>().allocate(ArraySize);
+		}
+
+		/// <summary>
+		/// Copy constructor, copies the objects in order (the copy starts at the front of its buffer). copying a moved from array gives another array without a buffer
+		/// </summary>
+		/// <param name="other">- array to copy</param>
+		RingDynamicArray(const RingDynamicArray& other) : RingDynamicArray()
+		{
+			if (other.MainArray == nullptr)
+			{
+				return;
+			}
+
+			MainArray = std::allocator<ArrayDataType>().allocate(other.ArraySize);
+			ArraySize = other.ArraySize;
+			for (const ArrayDataType& object : other)
+			{
+				Append(object);
+			}
+		}
+
+		/// <summary>
+		/// Move constructor, steals the buffer. the moved from array has no buffer, appending or prepending to it throws until it gets assigned to
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		RingDynamicArray(RingDynamicArray&& other) noexcept : MainArray(other.MainArray), ArraySize(other.ArraySize), Head(other.Head), ArrayIndexPointer(other.ArrayIndexPointer)
+		{
+			other.MainArray = nullptr;
+			other.ArraySize = 0;
+			other.Head = 0;
+			other.ArrayIndexPointer = 0;
+		}
+
+		~RingDynamicArray()
+		{
+			Clear();
+			if (MainArray != nullptr)
+				std::allocator<ArrayDataType>().deallocate(MainArray, ArraySize);
+		}
+	#pragma endregion
+
+	#pragma region MainArray Modification
+		/// <summary>
+		/// Constructs an object at the end of the buffer, if the buffer is full the first (oldest) object gets overwritten
+		/// </summary>
+		/// <param name="...args">- arguments which get passed to the constructor</param>
+		/// <returns>reference to the new object</returns>
+		template<typename... VariadicArgs>
+		ArrayDataType& EmplaceAppend(VariadicArgs&&... args)
+		{
+			CheckHasBuffer();
+
+			if (ArrayIndexPointer == ArraySize) /* full, the new object takes the place of the oldest one */
+			{
+				ArrayDataType newObject(std::forward<VariadicArgs>(args)...); /* constructed first in case args reference the oldest object */
+				ArrayDataType& oldest = MainArray[Head];
+				oldest = std::move(newObject);
+				Head = PhysicalPosition(1);
+				return oldest;
+			}
+
+			ArrayDataType* object = new (MainArray + PhysicalPosition(ArrayIndexPointer)) ArrayDataType(std::forward<VariadicArgs>(args)...);
+			ArrayIndexPointer++;
+			return *object;
+		}
+
+		/// <summary>
+		/// Append object to the end of the buffer, if the buffer is full the first (oldest) object gets overwritten
+		/// </summary>
+		/// <param name="objectToAdd">- object to add</param>
+		void Append(const ArrayDataType& objectToAdd)
+		{
+			EmplaceAppend(objectToAdd);
+		}
+
+		/// <summary>
+		/// Append object to the end of the buffer by moving it, if the buffer is full the first (oldest) object gets overwritten
+		/// </summary>
+		/// <param name="objectToAdd">- object to move in</param>
+		void Append(ArrayDataType&& objectToAdd)
+		{
+			EmplaceAppend(std::move(objectToAdd));
+		}
+
+		/// <summary>
+		/// Append multiple objects, if they don't fit the oldest objects get overwritten (only the last ArraySize objects of the input get kept)
+		/// </summary>
+		/// <param name="beginning">- pointer to the first object</param>
+		/// <param name="range">- amount of objects</param>
+		void MultiAppend(const ArrayDataType* beginning, const int& range)
+		{
+			int skip = (range > ArraySize ? range - ArraySize : 0); /* objects which would get overwritten anyway */
+			for (int i = skip; i < range; i++)
+			{
+				EmplaceAppend(beginning[i]);
+			}
+		}
+
+		/// <summary>
+		/// Constructs an object at the start of the buffer, if the buffer is full the last (newest) object gets overwritten
+		/// </summary>
+		/// <param name="...args">- arguments which get passed to the constructor</param>
+		/// <returns>reference to the new object</returns>
+		template<typename... VariadicArgs>
+		ArrayDataType& EmplacePrepend(VariadicArgs&&... args)
+		{
+			CheckHasBuffer();
+
+			int newHead = (Head == 0 ? ArraySize - 1 : Head - 1);
+			if (ArrayIndexPointer == ArraySize) /* full, newHead is the newest object */
+			{
+				ArrayDataType newObject(std::forward<VariadicArgs>(args)...); /* constructed first in case args reference the newest object */
+				MainArray[newHead] = std::move(newObject);
+			}
+			else
+			{
+				new (MainArray + newHead) ArrayDataType(std::forward<VariadicArgs>(args)...);
+				ArrayIndexPointer++;
+			}
+			Head = newHead;
+			return MainArray[newHead];
+		}
+
+		/// <summary>
+		/// Add object to the start of the buffer, if the buffer is full the last (newest) object gets overwritten
+		/// </summary>
+		/// <param name="objectToAdd">- object to add</param>
+		void Prepend(const ArrayDataType& objectToAdd)
+		{
+			EmplacePrepend(objectToAdd);
+		}
+
+		/// <summary>
+		/// Add object to the start of the buffer by moving it, if the buffer is full the last (newest) object gets overwritten
+		/// </summary>
+		/// <param name="objectToAdd">- object to move in</param>
+		void Prepend(ArrayDataType&& objectToAdd)
+		{
+			EmplacePrepend(std::move(objectToAdd));
+		}
+
+		/// <summary>
+		/// Removes the first (oldest) object
+		/// </summary>
+		void RemoveFirst()
+		{
+			if (ArrayIndexPointer == 0)
+			{
+				throw std::out_of_range("array is empty");
+			}
+
+			std::destroy_at(MainArray + Head);
+			Head = PhysicalPosition(1);
+			ArrayIndexPointer--;
+		}
+
+		/// <summary>
+		/// Removes the last (newest) object
+		/// </summary>
+		void RemoveLast()
+		{
+			if (ArrayIndexPointer == 0)
+			{
+				throw std::out_of_range("array is empty");
+			}
+
+			ArrayIndexPointer--;
+			std::destroy_at(MainArray + PhysicalPosition(ArrayIndexPointer));
+		}
+
+		/// <summary>
+		/// Destroys all the objects (the buffer stays)
+		/// </summary>
+		void Clear()
+		{
+			for (int i = 0; i < ArrayIndexPointer; i++)
+			{
+				std::destroy_at(MainArray + PhysicalPosition(i));
+			}
+			Head = 0;
+			ArrayIndexPointer = 0;
+		}
+	#pragma endregion
+
+	#pragma region Variable Returns
+		/// <summary>
+		/// Get the first (oldest) object
 		/// </summary>
-		/// <param name="StartSize"> - Starting size of the array</param>
-		/// <param name="StepSize"> - how much the array will increase each time it reaches the limit</param>
-		DynamicArray(const int& startSize, const int& stepSize)
+		/// <returns>reference to the first object</returns>
+		ArrayDataType& GetFirst()
 		{
-			ArrayDefaultSize = ArraySize = startSize;
-			ArrayStepSize = stepSize;
+			if (ArrayIndexPointer == 0)
+			{
+				throw std::out_of_range("array is empty");
+			}
+			return MainArray[Head];
+		}
 
-			// ! DO NOT CHANGE !
-			ArrayIndexPointer = 0;
-			MainArray = new ArrayDataType[ArraySize]();
+		/// <summary>
+		/// Get the last (newest) object
+		/// </summary>
+		/// <returns>reference to the last object</returns>
+		ArrayDataType& GetLast()
+		{
+			if (ArrayIndexPointer == 0)
+			{
+				throw std::out_of_range("array is empty");
+			}
+			return MainArray[PhysicalPosition(ArrayIndexPointer - 1)];
 		}
 
 		/// <summary>
-		/// Constructor to set all the variables
+		/// Get the first contiguous part of the objects (from the first object up to the end of the buffer or the last object)
 		/// </summary>
-		DynamicArray()
+		/// <returns>span of the first part</returns>
+		std::span<ArrayDataType> GetFirstSpan()
 		{
-			new (this) DynamicArray<ArrayDataType>(10, 10);
+			int firstCount = (Head + ArrayIndexPointer > ArraySize ? ArraySize - Head : ArrayIndexPointer);
+			return std::span<ArrayDataType>(MainArray + Head, firstCount);
 		}
 
-		/// Destroy array contained in object
-		~DynamicArray()
+		std::span<const ArrayDataType> GetFirstSpan() const
 		{
-			delete[] MainArray;
+			int firstCount = (Head + ArrayIndexPointer > ArraySize ? ArraySize - Head : ArrayIndexPointer);
+			return std::span<const ArrayDataType>(MainArray + Head, firstCount);
 		}
-	#pragma endregion
 
-	#pragma region MainArray Modification
 		/// <summary>
-		/// Append single Object
+		/// Get the second contiguous part of the objects (the part which wrapped around to the start of the buffer, empty if it didn't wrap)
 		/// </summary>
-		/// <param name="ObjectToAdd"> - Object to add</param>
-		void Append(const ArrayDataType& objectToAdd)
+		/// <returns>span of the second part</returns>
+		std::span<ArrayDataType> GetSecondSpan()
 		{
-			if (ArrayIndexPointer >= ArraySize) // if Current Index pointer is more then the array size (trying to add to OutOfRange space)
-			{
-				ArrayDataType* TempArray = new ArrayDataType[ArraySize](); // Create new array which will store the original values
-
-				for (int i = 0; i < ArraySize; i++) // assign/copy all values from Array to Temp
-				{
-					TempArray[i] = MainArray[i];
-				}
-
-				ArraySize += ArrayStepSize; // expand the Array size
-				MainArray = new ArrayDataType[ArraySize](); // over ride MainArray with new, bigger, array
-
-				/*
-				ArraySize-ArrayStepSize calculates TempArray size
-				Copy all values from Temp array to "old" expanded array
-				*/
-				for (int i = 0; i < ArraySize - ArrayStepSize; i++)
-				{
-					MainArray[i] = TempArray[i];
-
-				}
+			int secondCount = (Head + ArrayIndexPointer > ArraySize ? Head + ArrayIndexPointer - ArraySize : 0);
+			return std::span<ArrayDataType>(MainArray, secondCount);
+		}
 
-				delete[] TempArray;
-			}
+		std::span<const ArrayDataType> GetSecondSpan() const
+		{
+			int secondCount = (Head + ArrayIndexPointer > ArraySize ? Head + ArrayIndexPointer - ArraySize : 0);
+			return std::span<const ArrayDataType>(MainArray, secondCount);
+		}
 
-			MainArray[ArrayIndexPointer] = objectToAdd;
-			ArrayIndexPointer++;
+		/// <summary>
+		/// Get the most objects the buffer can hold
+		/// </summary>
+		/// <returns>capacity</returns>
+		int GetArraySize() const
+		{
+			return ArraySize;
 		}
 
 		/// <summary>
-		/// Adds from the beginning address to the range to the end of current array
+		/// Get the amount of objects in the buffer
 		/// </summary>
-		/// <param name="beginning">- the beginning address</param>
-		/// <param name="range">- the range of items wanted</param>
-		void MultiAppend(ArrayDataType* beginning, const int& range)
+		/// <returns>amount of objects</returns>
+		int GetArrayIndexPointer() const
 		{
-			for (int i = 0; i < range; i++){Append(beginning[i]);}
+			return ArrayIndexPointer;
 		}
 
 		/// <summary>
-		/// Adds from beginning address to end address to the end of current array
+		/// Get if the buffer is full (the next Append will overwrite the first object)
 		/// </summary>
-		/// <param name="beginning">- the beginning address</param>
-		/// <param name="end">- the end address</param>
-		void MultiAppend(ArrayDataType* beginning, ArrayDataType* end) /* TODO: Allow for custom starting point */
+		/// <returns>if the buffer is full</returns>
+		bool IsFull() const
 		{
-			int distance = std::distance(beginning, end);
-			MultiAppend(beginning, distance);
+			return ArrayIndexPointer == ArraySize;
 		}
+	#pragma endregion
+
+	#pragma region For Loop Functions
+		// For loop range-based function
+		iterator begin() { return iterator(this, 0); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		iterator end() { return iterator(this, ArrayIndexPointer); }
+		const_iterator end() const { return const_iterator(this, ArrayIndexPointer); }
+	#pragma endregion
 
+	#pragma region Operators
 		/// <summary>
-		/// Replaces a a chosen positin with the chosen Object
+		/// Copy assignment, copies the objects in order. the buffer gets the size of other
 		/// </summary>
-		/// <param name="ReplaceObject"> - Object to place in the position</param>
-		/// <param name="position"> - position to put the Object in</param>
-		void Replace(const ArrayDataType& replaceObject, const int& position)
+		/// <param name="other">- array to copy</param>
+		/// <returns>self</returns>
+		RingDynamicArray& operator=(const RingDynamicArray& other)
 		{
-			if (position >= (ArrayIndexPointer - 1) || position < 0)// check if the position to remove is in array range
+			if (this != &other)
 			{
-				throw std::out_of_range("position was out of range of the array");
-				return;
+				RingDynamicArray copy(other);
+				*this = std::move(copy);
 			}
+			return *this;
+		}
 
-			MainArray[position] = replaceObject;
+		/// <summary>
+		/// Move assignment, steals the buffer
+		/// </summary>
+		/// <param name="other">- array to move from</param>
+		/// <returns>self</returns>
+		RingDynamicArray& operator=(RingDynamicArray&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Clear();
+				if (MainArray != nullptr)
+					std::allocator<ArrayDataType>().deallocate(MainArray, ArraySize);
+
+				MainArray = other.MainArray;
+				ArraySize = other.ArraySize;
+				Head = other.Head;
+				ArrayIndexPointer = other.ArrayIndexPointer;
+				other.MainArray = nullptr;
+				other.ArraySize = 0;
+				other.Head = 0;
+				other.ArrayIndexPointer = 0;
+			}
+			return *this;
 		}
 
 		/// <summary>
-		/// Remove and move all Object infront, back 1 spot
+		/// wostream operator, writes both halves in order (wchar_t buffers get written as text)
 		/// </summary>
-		/// <param name="position"> - Position to remove</param>
-		void Remove(const int& position)
+		friend std::wostream& operator<<(std::wostream& os, const RingDynamicArray& ringArray)
 		{
-			if (position >= (ArrayIndexPointer - 1) || position < 0)// check if the position to remove is in array range
+			if constexpr (std::is_same_v<ArrayDataType, wchar_t>)
 			{
-				throw std::out_of_range("position was out of range of the array");
-				return;
+				os.write(ringArray.GetFirstSpan().data(), ringArray.GetFirstSpan().size());
+				os.write(ringArray.GetSecondSpan().data(), ringArray.GetSecondSpan().size());
+			}
+			else
+			{
+				for (int i = 0; i < ringArray.ArrayIndexPointer; i++)
+				{
+					os << ringArray[i] << (i + 1 < ringArray.ArrayIndexPointer ? L", " : L"");
+				}
 			}
+			return os;
+		}
 
-			for (int i = position; i < (ArrayIndexPointer - 1); i++) // moving all back
+		/// <summary>
+		/// ostream operator, writes both halves in order (char buffers get written as text)
+		/// </summary>
+		friend std::ostream& operator<<(std::ostream& os, const RingDynamicArray& ringArray)
+		{
+			if constexpr (std::is_same_v<ArrayDataType, char>)
 			{
-				MainArray[i] = MainArray[i + 1];
+				os.write(ringArray.GetFirstSpan().data(), ringArray.GetFirstSpan().size());
+				os.write(ringArray.GetSecondSpan().data(), ringArray.GetSecondSpan().size());
 			}
-			MainArray[ArrayIndexPointer - 1] = NULL; // make last character blank
-			ArrayIndexPointer--;
+			else
+			{
+				for (int i = 0; i < ringArray.ArrayIndexPointer; i++)
+				{
+					os << ringArray[i] << (i + 1 < ringArray.ArrayIndexPointer ? ", " : "");
+				}
+			}
+			return os;
 		}
 
 		/// <summary>
-		/// Clear the dynamic array to the original size
+		/// Get an object by position (0 = first/oldest object)
 		/// </summary>
-		void Clear()
+		ArrayDataType& operator[](const int& position)
 		{
-			ArrayIndexPointer = 0;
-			ArraySize = ArrayDefaultSize;
-			MainArray = new ArrayDataType[ArrayDefaultSize]();
+			return MainArray[PhysicalPosition(position)];
+		}
+
+		const ArrayDataType& operator[](const int& position) const
+		{
+			return MainArray[PhysicalPosition(position)];
 		}
 	#pragma endregion
+	};
 
-	#pragma region Variable Returns
+	/// <summary>
+	/// Append only DynamicArray which multiple threads can append to at the same time without locking.
+	/// objects are stored in segments (each one double the size of the last) which never move once they are created,
+	/// so references stay valid and readers can go through a snapshot while other threads are still appending
+	/// </summary>
+	/// <typeparam name="ArrayDataType">- datatype of the array</typeparam>
+	/// <typeparam name="FirstSegmentSize">(default = 64) - size of the first segment (has to be a power of 2)</typeparam>
+	template<class ArrayDataType, int FirstSegmentSize = 64>
+	class ConcurrentDynamicArray
+	{
+		static_assert(FirstSegmentSize > 0 && (FirstSegmentSize & (FirstSegmentSize - 1)) == 0, "FirstSegmentSize has to be a power of 2");
+	private:
 		/// <summary>
-		/// Return array contained in the object
+		/// what state the object in a slot is in
 		/// </summary>
-		/// <returns>Object array</returns>
-		ArrayDataType* GetArray()
+		enum SlotState : uint8_t
 		{
-			return MainArray;
-		}
+			SlotPending = 0,	/* index got handed out, object is still being constructed */
+			SlotReady = 1,		/* object is constructed */
+			SlotFailed = 2,		/* constructor threw, the slot stays empty and gets skipped */
+		};
 
 		/// <summary>
-		/// Returns the max array size (won't be the current index)
+		/// storage for one object and the state which says if the object is done being constructed
 		/// </summary>
-		/// <returns>int of current array size</returns>
-		int GetArraySize()
+		struct Slot
 		{
-			return ArraySize;
+			alignas(ArrayDataType) unsigned char Storage[sizeof(ArrayDataType)];	/* uninitialized storage for the object */
+			std::atomic<uint8_t> State{ SlotPending };								/* set (release) once the object is constructed or its constructor threw */
+
+			ArrayDataType* GetObject() { return std::launder(reinterpret_cast<ArrayDataType*>(Storage)); }
+		};
+
+		static constexpr int MaxSegments = 32 - std::countr_zero((unsigned)FirstSegmentSize);	/* enough segments to hold INT_MAX objects */
+
+		std::atomic<Slot*> Segments[MaxSegments];	/* segment table, a segment never moves once it is published */
+		std::atomic<int> ArrayIndexPointer;			/* next index which gets handed out (can be ahead of the constructed objects) */
+		mutable std::atomic<int> PublishedCount;		/* length of the prefix where every object is constructed */
+
+		/// <summary>
+		/// Gets which segment an index is in
+		/// </summary>
+		static int SegmentOf(const int& index)
+		{
+			return std::bit_width((unsigned)(index / FirstSegmentSize + 1)) - 1;
 		}
 
 		/// <summary>
-		/// Returns the starting size and the size it will return to when clearing
+		/// Gets the size of a segment
 		/// </summary>
-		/// <returns>int of starting size and the size it will return to when clearing</returns>
-		int GetArrayDefaultSize()
+		static size_t SegmentSize(const int& segment)
 		{
-			return ArrayDefaultSize;
+			return (size_t)FirstSegmentSize << segment;
 		}
 
 		/// <summary>
-		/// Returns the current index/amount of objects in the array
+		/// Gets the index of the first object in a segment
 		/// </summary>
-		/// <returns>index/amount of objects in array</returns>
-		int GetArrayIndexPointer()
+		static int SegmentStart(const int& segment)
 		{
-			return ArrayIndexPointer;
+			return FirstSegmentSize * ((1 << segment) - 1);
 		}
 
 		/// <summary>
-		/// Returns the steps size
+		/// Gets the segment, creating it if this thread is the first one to need it. if 2 threads create it at the same time, the loser frees its copy
 		/// </summary>
-		/// <returns>step size</returns>
-		int GetArrayStepSize()
+		Slot* GetOrCreateSegment(const int& segment)
 		{
-			return ArrayStepSize;
+			Slot* current = Segments[segment].load(std::memory_order_acquire);
+			if (current != nullptr)
+			{
+				return current;
+			}
+
+			Slot* created = new Slot[SegmentSize(segment)];
+			if (Segments[segment].compare_exchange_strong(current, created, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				return created;
+			}
+
+			delete[] created;
+			return current;
 		}
-	#pragma endregion
 
-	#pragma region For Loop Functions
-		// For loop range-based function
-		iterator begin() { return &MainArray[0]; }
-		const_iterator begin() const { return &MainArray[0]; }
-		iterator end() { return &MainArray[ArrayIndexPointer]; }
-		const_iterator end() const { return &MainArray[ArrayIndexPointer]; }
-	#pragma endregion
+		/// <summary>
+		/// Gets the slot of an index, or nullptr if its segment doesn't exist yet
+		/// </summary>
+		Slot* FindSlot(const int& index) const
+		{
+			int segment = SegmentOf(index);
+			Slot* segmentArray = Segments[segment].load(std::memory_order_acquire);
+			return (segmentArray == nullptr ? nullptr : segmentArray + (index - SegmentStart(segment)));
+		}
 
-	#pragma region Operators
 		/// <summary>
-		/// What to do incase of << operator with wostream
+		/// Moves PublishedCount forward over every slot which is done (constructed or failed)
 		/// </summary>
-		/// <param name="os">- output stream</param>
-		/// <param name="Array">- the array object</param>
-		/// <returns></returns>
-		friend std::wostream& operator<<(std::wostream& os, const DynamicArray& MainArray) /* TODO: make wostream and ostream be 1 function which uses std::basic_stream */
+		/// <returns>the new published count</returns>
+		int UpdatePublishedCount() const
 		{
-			if constexpr (std::is_same<ArrayDataType, std::wstring>::value || std::is_same<ArrayDataType, wchar_t>::value) /* if the array contained is either string, wstring, char or wchar. output as normal */
+			int published = PublishedCount.load(std::memory_order_acquire);
+			int reserved = ArrayIndexPointer.load(std::memory_order_acquire);
+			int scan = published;
+
+			if (reserved < 0) /* the counter wrapped once the array got full, every index under INT_MAX was handed out */
 			{
-				os << MainArray.MainArray;
+				reserved = INT_MAX;
 			}
-			else  /* if type is any other "list" the array with comman */
+
+			while (scan < reserved)
 			{
-				for (int i = 0; i < MainArray.ArrayIndexPointer; i++)
+				Slot* slot = FindSlot(scan);
+				if (slot == nullptr || slot->State.load(std::memory_order_acquire) == SlotPending)
 				{
-					os << MainArray.MainArray[i];
+					break;
+				}
+				scan++;
+			}
 
-					if (!(i == MainArray.ArrayIndexPointer - 1))
+			while (published < scan && !PublishedCount.compare_exchange_weak(published, scan, std::memory_order_acq_rel, std::memory_order_acquire)) {}
+			return (published > scan ? published : scan);
+		}
+	public:
+		/// <summary>
+		/// view of the published objects at the time it was taken. objects appended afterwards aren't included, so it stays the same while other threads append.
+		/// indexes whose constructor threw are skipped when iterating
+		/// </summary>
+		class Snapshot
+		{
+		private:
+			const ConcurrentDynamicArray* Array;	/* array the snapshot is of */
+			int Count;								/* amount of objects in the snapshot */
+		public:
+			/// <summary>
+			/// forward iterator over the snapshot, moves between segments as it goes and skips failed indexes
+			/// </summary>
+			class const_iterator
+			{
+			private:
+				const ConcurrentDynamicArray* Array;	/* array being iterated */
+				int Index;								/* current index */
+				int Count;								/* amount of indexes in the snapshot */
+
+				/// <summary>
+				/// Moves Index forward until it is on a constructed object or the end
+				/// </summary>
+				void SkipFailed()
+				{
+					while (Index < Count && !Array->IsConstructed(Index))
 					{
-						os << ", ";
+						Index++;
 					}
 				}
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = ArrayDataType;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const ArrayDataType*;
+				using reference = const ArrayDataType&;
+
+				const_iterator(const ConcurrentDynamicArray* array, const int& index, const int& count) : Array(array), Index(index), Count(count) { SkipFailed(); }
+
+				reference operator*() const { return (*Array)[Index]; }
+				pointer operator->() const { return &(*Array)[Index]; }
+				const_iterator& operator++() { Index++; SkipFailed(); return *this; }
+				const_iterator operator++(int) { const_iterator copy = *this; ++(*this); return copy; }
+				bool operator==(const const_iterator& other) const { return Index == other.Index; }
+				bool operator!=(const const_iterator& other) const { return Index != other.Index; }
+			};
+
+			Snapshot(const ConcurrentDynamicArray* array, const int& count) : Array(array), Count(count) {}
+
+			/// <summary>
+			/// Gets the amount of indexes in the snapshot (includes indexes whose constructor threw)
+			/// </summary>
+			/// <returns>amount of indexes</returns>
+			int GetArrayIndexPointer() const
+			{
+				return Count;
 			}
-			return os;
+
+			const ArrayDataType& operator[](const int& position) const
+			{
+				if (position < 0 || position >= Count)
+				{
+					throw std::out_of_range("position was out of range");
+				}
+				if (!Array->IsConstructed(position))
+				{
+					throw std::out_of_range("object at position failed to construct");
+				}
+				return (*Array)[position];
+			}
+
+			const_iterator begin() const { return const_iterator(Array, 0, Count); }
+			const_iterator end() const { return const_iterator(Array, Count, Count); }
+		};
+
+	#pragma region Constructors
+		ConcurrentDynamicArray()
+		{
+			for (std::atomic<Slot*>& segment : Segments)
+			{
+				segment.store(nullptr, std::memory_order_relaxed);
+			}
+			ArrayIndexPointer.store(0, std::memory_order_relaxed);
+			PublishedCount.store(0, std::memory_order_relaxed);
 		}
 
+		ConcurrentDynamicArray(const ConcurrentDynamicArray&) = delete;
+		ConcurrentDynamicArray& operator=(const ConcurrentDynamicArray&) = delete;
+
 		/// <summary>
-		/// What to do incase of << operator with ostream
+		/// Destroys the objects and frees the segments. no other thread can be appending at this point
 		/// </summary>
-		/// <param name="os">- output stream</param>
-		/// <param name="Array">- the array object</param>
-		/// <returns></returns>
-		friend std::ostream& operator<<(std::ostream& os, const DynamicArray& MainArray)
+		~ConcurrentDynamicArray()
 		{
-			if (std::is_same<ArrayDataType, std::string>::value || std::is_same<ArrayDataType, char>::value) /* if the array contained is either string, wstring, char or wchar. output as normal */
-			{
-				os << MainArray.MainArray;
-			}
-			else  /* if type is any other "list" the array with comman */
+			for (int segment = 0; segment < MaxSegments; segment++)
 			{
-				for (int i = 0; i < MainArray.ArrayIndexPointer; i++)
+				Slot* segmentArray = Segments[segment].load(std::memory_order_acquire);
+				if (segmentArray == nullptr)
 				{
-					os << MainArray.MainArray[i];
+					continue;
+				}
 
-					if (!(i == MainArray.ArrayIndexPointer - 1))
+				for (size_t i = 0; i < SegmentSize(segment); i++)
+				{
+					if (segmentArray[i].State.load(std::memory_order_relaxed) == SlotReady)
 					{
-						os << ", ";
+						std::destroy_at(segmentArray[i].GetObject());
 					}
 				}
+				delete[] segmentArray;
 			}
-			return os;
 		}
+	#pragma endregion
 
+	#pragma region MainArray Modification
 		/// <summary>
-		/// [] operator which acts the same as the Array [] operator
+		/// Constructs an object at the end of the array, safe to call from any amount of threads at once.
+		/// takes a single atomic increment, the only extra work is creating a segment when the index is the first one to need it.
+		/// if the constructor throws, the index stays empty (later appends still get published) and the exception gets rethrown
 		/// </summary>
-		/// <param name="position">- position of the value wanted</param>
-		/// <returns>value in the position</returns>
-		ArrayDataType& operator[](const int& position)
+		/// <param name="...args">- arguments which get passed to the constructor</param>
+		/// <returns>index of the new object</returns>
+		template<typename... VariadicArgs>
+		int EmplaceAppend(VariadicArgs&&... args)
 		{
-			return MainArray[position];
+			int index = ArrayIndexPointer.fetch_add(1, std::memory_order_relaxed);
+			if (index < 0 || index == INT_MAX)
+			{
+				throw std::length_error("ConcurrentDynamicArray is full");
+			}
+
+			int segment = SegmentOf(index);
+			Slot& slot = GetOrCreateSegment(segment)[index - SegmentStart(segment)];
+			try
+			{
+				new (slot.Storage) ArrayDataType(std::forward<VariadicArgs>(args)...);
+			}
+			catch (...)
+			{
+				slot.State.store(SlotFailed, std::memory_order_release);
+				throw;
+			}
+			slot.State.store(SlotReady, std::memory_order_release);
+			return index;
 		}
 
 		/// <summary>
-		/// Inserts object into self
+		/// Appends an object to the end of the array, safe to call from any amount of threads at once
 		/// </summary>
-		/// <param name="insersationObject">- the object to insert</param>
-		/// <returns>combined objects</returns>
-		DynamicArray<ArrayDataType>& operator<<(DynamicArray<ArrayDataType>& insersationObject)
+		/// <param name="objectToAdd">- object to add</param>
+		/// <returns>index of the new object</returns>
+		int Append(const ArrayDataType& objectToAdd)
 		{
-			this->MultiAppend(insersationObject.begin(), insersationObject.end());
-			return *this;
+			return EmplaceAppend(objectToAdd);
 		}
 
 		/// <summary>
-		/// Inserts object into self
+		/// Appends an object to the end of the array by moving it, safe to call from any amount of threads at once
 		/// </summary>
-		/// <param name="insersationObject">- the object to insert</param>
-		/// <returns>combined objects</returns>
-		DynamicArray<ArrayDataType>& operator+=(DynamicArray<ArrayDataType>& insersationObject)
+		/// <param name="objectToAdd">- object to move in</param>
+		/// <returns>index of the new object</returns>
+		int Append(ArrayDataType&& objectToAdd)
 		{
-			this->MultiAppend(insersationObject.begin(), insersationObject.end());
-			return *this;
+			return EmplaceAppend(std::move(objectToAdd));
+		}
+	#pragma endregion
+
+	#pragma region Variable Returns
+		/// <summary>
+		/// Takes a snapshot of all the objects which are done being appended
+		/// </summary>
+		/// <returns>the snapshot</returns>
+		Snapshot GetSnapshot() const
+		{
+			return Snapshot(this, UpdatePublishedCount());
+		}
+
+		/// <summary>
+		/// Gets how many indexes are done being appended (every index under this can be read, unless IsConstructed says its constructor threw)
+		/// </summary>
+		/// <returns>amount of published indexes</returns>
+		int GetArrayIndexPointer() const
+		{
+			return UpdatePublishedCount();
+		}
+
+		/// <summary>
+		/// Checks if the object at a published index got constructed (false if its constructor threw)
+		/// </summary>
+		/// <param name="position">- published index to check</param>
+		/// <returns>if there is an object at the index</returns>
+		bool IsConstructed(const int& position) const
+		{
+			Slot* slot = FindSlot(position);
+			return slot != nullptr && slot->State.load(std::memory_order_acquire) == SlotReady;
+		}
+	#pragma endregion
+
+	#pragma region Operators
+		/// <summary>
+		/// Gets an object. the index has to be published (returned by Append on this thread, or under GetArrayIndexPointer), there is no check
+		/// </summary>
+		ArrayDataType& operator[](const int& position)
+		{
+			return *FindSlot(position)->GetObject();
+		}
+
+		const ArrayDataType& operator[](const int& position) const
+		{
+			return *FindSlot(position)->GetObject();
 		}
 	#pragma endregion
 	};
@@ -29,7 +29,9 @@ namespace NosStdLib
 		int CurrentWriteRow, PreviousWriteRow;		/* Current and previous loading bar write row  */
 		float PercentageDone;						/* decimal percentage of progress */
 		std::wstring StatusMessage;					/* Status message (Might need to move to local instead of global) */
+		NosStdLib::String::InternedString<wchar_t> InternedStatusMessage; /* handle of the last interned status message, sending the same one again skips copying it */
 		bool CenterStatusMesage;					/* if the StatusMessage should get centered. takes stress off the work thread and gets done on the drawing thread */
+		NosStdLib::String::Builder<wchar_t> FrameBuilder; /* bar and status message of a frame, reused so drawing doesn't allocate every frame */
 
 		static inline HANDLE ConsoleHandle;												/* global and static Console Handle */
 		static inline CONSOLE_SCREEN_BUFFER_INFO csbi;									/* global and static Console ScreenBI */
@@ -46,10 +48,21 @@ namespace NosStdLib
 			PreviousWriteRow = CurrentWriteRow; /* before recalculating new writing row, save it incase its different and the old one needs clearing */
 
 			/* recalculate writing row, either 4 above the bottom (with status message) or right below the splash screen */
-			CurrentWriteRow = max((ConsoleSizeStruct.Rows - 4) - (std::count(StatusMessage.begin(), StatusMessage.end(), L'\n')), (std::count(SplashScreen.begin(), SplashScreen.end(), L'\n') + 1));
+			CurrentWriteRow = max((ConsoleSizeStruct.Rows - 4) - (int)NosStdLib::String::CountChar(StatusMessage, L'\n'), (int)NosStdLib::String::CountChar(SplashScreen, L'\n') + 1);
 
 			if (CurrentWriteRow != PreviousWriteRow) /* if CurrentWriteRow and PreviousWriteRow are not equal (write position changed), clear previous */
-				NosStdLib::Global::Console::ClearRange(PreviousWriteRow, std::count(StatusMessage.begin(), StatusMessage.end(), L'\n') + 1);
+				NosStdLib::Global::Console::ClearRange(PreviousWriteRow, (int)NosStdLib::String::CountChar(StatusMessage, L'\n') + 1);
+		}
+
+		/// <summary>
+		/// Appends the status message (centered if CenterStatusMesage is set) to the frame
+		/// </summary>
+		void AppendStatusMessage()
+		{
+			if (CenterStatusMesage)
+				FrameBuilder.AppendCentered(StatusMessage, ConsoleSizeStruct.Columns, true, true);
+			else
+				FrameBuilder.Append(StatusMessage);
 		}
 
 		/// <summary>
@@ -68,25 +81,26 @@ namespace NosStdLib
 
 			ConsoleSizeStruct = NosStdLib::Global::Console::GetConsoleSize(ConsoleHandle, &csbi);
 
-			std::wstring bar = L"";
-
 			SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)CurrentWriteRow });
 			while (PercentageDone < 1 && !CrossThreadFinishBoolean)
 			{
 				int maxLenght = max(ConsoleSizeStruct.Columns - 60, 20);
 				float left = PercentageDone * maxLenght;
+				int leftPadding = max(((ConsoleSizeStruct.Columns / 2) - maxLenght / 2), 0);
 
-				bar += std::wstring((left / 1.0), L'█');
-				
-				bar += std::wstring(fmod(left, 1.0)/ 0.5, L'▌');
+				FrameBuilder.Clear();
+				FrameBuilder.AppendRepeat(L' ', leftPadding);
+				size_t barStart = FrameBuilder.GetSize();
+				FrameBuilder.AppendRepeat(L'█', (int)left).AppendRepeat(L'▌', (int)(fmod(left, 1.0) / 0.5));
+				int barSize = (int)(FrameBuilder.GetSize() - barStart);
+				FrameBuilder.AppendRepeat(L' ', ConsoleSizeStruct.Columns - (barSize + ((ConsoleSizeStruct.Columns / 2) - maxLenght / 2))).Append(L'\n');
+				AppendStatusMessage();
 
 				SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)CurrentWriteRow });
-				wprintf((std::wstring(max(((ConsoleSizeStruct.Columns/ 2) - maxLenght / 2), 0), L' ') + bar + std::wstring(max((ConsoleSizeStruct.Columns - (bar.size() + ((ConsoleSizeStruct.Columns / 2) - maxLenght / 2))), 0), L' ') + L"\n").c_str());
-				wprintf(CenterStatusMesage ? NosStdLib::String::CenterString(StatusMessage, true, true).c_str() : StatusMessage.c_str());
+				wprintf(FrameBuilder.GetCString());
 
 				Sleep(100);
 				MidOperationUpdate();
-				bar = L"";
 			}
 
 			FunctionThread.join();
@@ -121,19 +135,23 @@ namespace NosStdLib
 					GoingRight = !GoingRight;
 				if (GoingRight)
 				{
-					SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)CurrentWriteRow });
-					wprintf((std::wstring(max(((ConsoleSizeStruct.Columns / 2) - maxLenght / 2), 0), L' ') + MoveRight(&bar) + std::wstring(max((ConsoleSizeStruct.Columns - (bar.size() + ((ConsoleSizeStruct.Columns / 2) - maxLenght / 2))), 0), L' ') + L"\n").c_str());
-					wprintf(CenterStatusMesage ? NosStdLib::String::CenterString(StatusMessage, true, true).c_str() : StatusMessage.c_str());
+					MoveRight(&bar);
 					MidPosition++;
 				}
 				else
 				{
-					SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)CurrentWriteRow });
-					wprintf((std::wstring(max(((ConsoleSizeStruct.Columns / 2) - maxLenght / 2), 0), L' ') + MoveLeft(&bar) + std::wstring(max((ConsoleSizeStruct.Columns - (bar.size() + ((ConsoleSizeStruct.Columns / 2) - maxLenght / 2))), 0), L' ') + L"\n").c_str());
-					wprintf(CenterStatusMesage ? NosStdLib::String::CenterString(StatusMessage, true, true).c_str() : StatusMessage.c_str());
+					MoveLeft(&bar);
 					MidPosition--;
 				}
 
+				FrameBuilder.Clear();
+				FrameBuilder.AppendRepeat(L' ', max(((ConsoleSizeStruct.Columns / 2) - maxLenght / 2), 0)).Append(bar)
+							.AppendRepeat(L' ', ConsoleSizeStruct.Columns - ((int)bar.size() + ((ConsoleSizeStruct.Columns / 2) - maxLenght / 2))).Append(L'\n');
+				AppendStatusMessage();
+
+				SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)CurrentWriteRow });
+				wprintf(FrameBuilder.GetCString());
+
 				int sleepTime = 0;
 				if (MidPosition >= TrueMid)
 					sleepTime = ((float)(MidPosition + 1) / 15) * 50;
@@ -304,6 +322,25 @@ namespace NosStdLib
 		{
 			PercentageDone = percentageDone;
 			StatusMessage = statusMessage;
+			InternedStatusMessage = NosStdLib::String::InternedString<wchar_t>();
+			CenterStatusMesage = centerStatusMessage;
+		}
+
+		/// <summary>
+		/// Function used inside the function that is being loaded, updates different parameters.
+		/// for status messages which repeat every tick: the message only gets copied when it is a different handle then last time (O(1) compare)
+		/// </summary>
+		/// <param name="percentageDone">- Percent done in decimal form</param>
+		/// <param name="statusMessage">- interned status message that gets displayed below the loading bar</param>
+		/// <param name="centerStatusMessage">(default = true) - if statusMessage should get centered, if yes. will get centered in the drawing thread</param>
+		void UpdateKnownProgressBar(float percentageDone, NosStdLib::String::InternedString<wchar_t> statusMessage, bool centerStatusMessage = true)
+		{
+			PercentageDone = percentageDone;
+			if (statusMessage != InternedStatusMessage || statusMessage.GetSize() != StatusMessage.size()) /* the plain overload clears the handle, so an empty handle still has to check the size */
+			{
+				StatusMessage.assign(statusMessage.GetView());
+				InternedStatusMessage = statusMessage;
+			}
 			CenterStatusMesage = centerStatusMessage;
 		}
 
@@ -321,8 +358,8 @@ namespace NosStdLib
 		/// Move the contents of a string right by 1 space
 		/// </summary>
 		/// <param name="string">- the string to move right</param>
-		/// <returns>modified string</returns>
-		std::wstring MoveRight(std::wstring* string)
+		/// <returns>reference to the modified string</returns>
+		std::wstring& MoveRight(std::wstring* string)
 		{
 			wchar_t LastChar = (*string)[string->length() - 1];
 			for (int ii = string->length() - 1; ii >= 0; ii--)
@@ -340,8 +377,8 @@ namespace NosStdLib
 		/// Move the contents of a string left by 1 space
 		/// </summary>
 		/// <param name="string">- the string to move left</param>
-		/// <returns>modified string</returns>
-		std::wstring MoveLeft(std::wstring* string)
+		/// <returns>reference to the modified string</returns>
+		std::wstring& MoveLeft(std::wstring* string)
 		{
 			wchar_t LastChar = (*string)[0];
 			for (int ii = 0; ii <= string->length() - 1; ii++)
@@ -6,6 +6,7 @@
 #include "UnicodeTextGenerator.hpp"
 #include "Functional.hpp"
 #include "TextColor.hpp"
+#include "String.hpp"
 
 #include <Windows.h>
 #include <conio.h>
@@ -48,20 +49,44 @@ namespace NosStdLib
 		class MenuEntryBase
 		{
 		protected:
-			std::wstring EntryName; /* The entry name */
+			NosStdLib::String::InternedString<wchar_t> EntryName; /* The entry name (interned, menus tend to reuse the same names) */
 
 			HANDLE* MenuConsoleHandle;												/* a pointer to the menu's MenuConsoleHandle, so its synced */
 			CONSOLE_SCREEN_BUFFER_INFO* MenuConsoleScreenBI;						/* a pointer to the menu's MenuConsoleScreenBI, so its synced */
 			NosStdLib::Global::Console::ConsoleSizeStruct* MenuConsoleSizeStruct;	/* a pointer to the menu's MenuConsoleSizeStruct, so its synced */
+
+			/// <summary>
+			/// Appends the right padding (clears what is left over from a longer entry which was drawn there before) and the line ending
+			/// </summary>
+			/// <param name="output">- builder the entry is being built in</param>
+			/// <param name="lineStart">- size of the builder before the entry was started</param>
+			/// <param name="lineEnding">(default = L"\n") - what to end the line with</param>
+			void AppendEntryEnd(NosStdLib::String::Builder<wchar_t>& output, const size_t& lineStart, const wchar_t* lineEnding = L"\n")
+			{
+				int lineSize = (int)(output.GetSize() - lineStart);
+				output.AppendRepeat(L' ', MenuConsoleSizeStruct->Columns - (lineSize + ((MenuConsoleSizeStruct->Columns / 2) - lineSize / 2))).Append(lineEnding);
+			}
 		public:
+			/// <summary>
+			/// append the Entry (name, value and centered) to a builder, so the menu can draw everything without temporary strings
+			/// </summary>
+			/// <param name="output">- builder to append to</param>
+			/// <param name="selected">- if the entry is selected or not</param>
+			virtual void AppendEntryString(NosStdLib::String::Builder<wchar_t>& output, bool selected)
+			{
+				output.Append(EntryName);
+			}
+
 			/// <summary>
 			/// create a wstring which shows the Entry name, value and is also centered
 			/// </summary>
 			/// <param name="selected">- if the entry is selected or not</param>
 			/// <returns>wstring which shows the Entry name, value and is also centered</returns>
-			virtual std::wstring EntryString(bool selected)
+			std::wstring EntryString(bool selected)
 			{
-				return EntryName;
+				NosStdLib::String::Builder<wchar_t> output;
+				AppendEntryString(output, selected);
+				return output.Release();
 			}
 
 			/// <summary>
@@ -108,33 +133,45 @@ namespace NosStdLib
 			/// <param name="name">- entry name</param>
 			/// <param name="typePointerStore">- pointer to variable of type</param>
 			MenuEntry(std::wstring name, EntryType* typePointerStore)
+			{
+				EntryName = NosStdLib::String::Interner<wchar_t>::GetGlobal().Intern(name);
+				TypePointerStore = typePointerStore;
+			}
+
+			/// <summary>
+			/// Function Entry with an already interned name
+			/// </summary>
+			/// <param name="name">- entry name (from the global interner)</param>
+			/// <param name="typePointerStore">- pointer to variable of type</param>
+			MenuEntry(NosStdLib::String::InternedString<wchar_t> name, EntryType* typePointerStore)
 			{
 				EntryName = name;
 				TypePointerStore = typePointerStore;
 			}
 
 			/// <summary>
-			/// create a wstring which shows the Entry name, value and is also centered
+			/// append the Entry (name, value and centered) to a builder
 			/// </summary>
+			/// <param name="output">- builder to append to</param>
 			/// <param name="selected">- if the entry is selected or not</param>
-			/// <returns>wstring which shows the Entry name, value and is also centered</returns>
-			std::wstring EntryString(bool selected)
+			void AppendEntryString(NosStdLib::String::Builder<wchar_t>& output, bool selected) override
 			{
 				*MenuConsoleSizeStruct = NosStdLib::Global::Console::GetConsoleSize(*MenuConsoleHandle, MenuConsoleScreenBI); /* Update values */
 
-				int SpaceLenght = ((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2);
+				int SpaceLenght = ((MenuConsoleSizeStruct->Columns / 2) - (int)EntryName.GetSize() / 2);
 
 				if constexpr (std::is_base_of_v<NosStdLib::Functional::FunctionStoreBase, EntryType>)
 				{
-					std::wstring output = (selected ? 
-										   std::wstring(SpaceLenght - 3, ' ') + L">> " + EntryName + L" <<" :
-										   std::wstring(SpaceLenght - 0, ' ') + L"" + EntryName + L"");
-					output += std::wstring(max((MenuConsoleSizeStruct->Columns - (output.size() + ((MenuConsoleSizeStruct->Columns / 2) - output.size() / 2))), 0), L' ') + L'\n';
-					return output;
+					size_t lineStart = output.GetSize();
+					if (selected)
+						output.AppendRepeat(L' ', SpaceLenght - 3).Append(L">> ").Append(EntryName).Append(L" <<");
+					else
+						output.AppendRepeat(L' ', SpaceLenght).Append(EntryName);
+					AppendEntryEnd(output, lineStart);
 				}
 				else
 				{
-					return L"generic";
+					output.Append(L"generic");
 				}
 			}
 
@@ -176,7 +213,10 @@ namespace NosStdLib
 			HANDLE ConsoleHandle;											/* global Console Handle so it is synced across all operations and so it doesn't have to retrieved */
 			CONSOLE_SCREEN_BUFFER_INFO ConsoleScreenBI;						/* global ConsoleScreenBI so it is synced across all operations */
 			NosStdLib::Global::Console::ConsoleSizeStruct ConsoleSizeStruct;/* a struct container for the Console colums and rows */
-			NosStdLib::DynamicArray<MenuEntryBase*> MenuEntryList;			/* array of MenuEntries */
+			NosStdLib::StableDynamicArray<MenuEntryBase*, 32> MenuEntryList;	/* array of MenuEntries (stable, so slots stay valid while entries get added) */
+			NosStdLib::String::Builder<wchar_t> FrameBuilder;				/* reused for every draw, so redrawing doesn't allocate once it is big enough */
+			std::wstring GeneratedTitle;									/* the unicode title, only gets generated again when the console width changes */
+			int GeneratedTitleColumns;										/* console width GeneratedTitle was made for (-1 before the first draw) */
 
 			bool MenuLoop,				/* if the menu should continue looping (true -> yes, false -> no) */
 				 GenerateUnicodeTitle,	/* if to generate a big Unicode title */
@@ -190,6 +230,7 @@ namespace NosStdLib
 				AddExitEntry = addExitEntry;
 				GenerateUnicodeTitle = generateUnicodeTitle;
 				CenterTitle = centerTitle;
+				GeneratedTitleColumns = -1;
 
 				ConsoleHandle = GetStdHandle(STD_OUTPUT_HANDLE);
 			}
@@ -289,7 +330,10 @@ namespace NosStdLib
 					if (currentIndex > oldIndex && oldIndex != currentIndex) /* Going Down */
 					{
 						SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)(titleSize + currentIndex - 1) });
-						wprintf((MenuEntryList[oldIndex]->EntryString(false) + MenuEntryList[currentIndex]->EntryString(true)).c_str());
+						FrameBuilder.Clear();
+						MenuEntryList[oldIndex]->AppendEntryString(FrameBuilder, false);
+						MenuEntryList[currentIndex]->AppendEntryString(FrameBuilder, true);
+						wprintf(FrameBuilder.GetCString());
 
 						if ((titleSize + currentIndex) + (ConsoleSizeStruct.Rows / 2) < 0)
 							finalPosition = { 0,0 };
@@ -301,7 +345,10 @@ namespace NosStdLib
 					else if(oldIndex != currentIndex)/* Going Up */
 					{
 						SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)(titleSize + currentIndex) });
-						wprintf((MenuEntryList[currentIndex]->EntryString(true) + MenuEntryList[oldIndex]->EntryString(false)).c_str());
+						FrameBuilder.Clear();
+						MenuEntryList[currentIndex]->AppendEntryString(FrameBuilder, true);
+						MenuEntryList[oldIndex]->AppendEntryString(FrameBuilder, false);
+						wprintf(FrameBuilder.GetCString());
 
 						if ((titleSize + currentIndex) - (ConsoleSizeStruct.Rows / 2) < 0)
 							finalPosition = { 0,0 };
@@ -342,28 +389,32 @@ namespace NosStdLib
 
 				ConsoleSizeStruct = NosStdLib::Global::Console::GetConsoleSize(ConsoleHandle, &ConsoleScreenBI);
 
-				std::wstring outputString; /* string for full "display" as it is the most perfomace efficent method */
+				FrameBuilder.Clear(); /* whole "display" gets built in one buffer as it is the most perfomace efficent method */
 
 				if (GenerateUnicodeTitle) /* If custom Title is true, its going to use the straight characters instead of generating a unicode title */
-					outputString = NosStdLib::UnicodeTextGenerator::BasicUnicodeTextGenerate(ConsoleHandle, Title, CenterTitle); // add title with "ascii generator"
+				{
+					if (GeneratedTitleColumns != ConsoleSizeStruct.Columns)
+					{
+						GeneratedTitle = NosStdLib::UnicodeTextGenerator::BasicUnicodeTextGenerate(ConsoleHandle, Title, CenterTitle); // add title with "ascii generator"
+						GeneratedTitleColumns = ConsoleSizeStruct.Columns;
+					}
+					FrameBuilder.Append(GeneratedTitle);
+				}
 				else
 					if (CenterTitle)
-						outputString = std::wstring(((ConsoleSizeStruct.Columns / 2) - Title.length() / 2), ' ') + Title;
+						FrameBuilder.AppendRepeat(L' ', (ConsoleSizeStruct.Columns / 2) - (int)Title.length() / 2).Append(Title);
 					else
-						outputString = Title;
+						FrameBuilder.Append(Title);
 
-				*titleSize = std::count(outputString.begin(), outputString.end(), L'\n');
+				*titleSize = (int)NosStdLib::String::CountChar(FrameBuilder.GetView(), L'\n');
 
 				// for loop using counter to get the index so to add the >< to the selected option
 				for (int i = 0; i < MenuEntryList.GetArrayIndexPointer(); i++)
 				{
-					if (i == currentIndex)
-						outputString += MenuEntryList[i]->EntryString(true);
-					else
-						outputString += MenuEntryList[i]->EntryString(false);
+					MenuEntryList[i]->AppendEntryString(FrameBuilder, i == currentIndex);
 				}
 
-				wprintf(outputString.c_str());
+				wprintf(FrameBuilder.GetCString());
 
 				SetConsoleCursorPosition(ConsoleHandle, { 0, (SHORT)(currentIndex) });
 			}
@@ -381,19 +432,19 @@ namespace NosStdLib
 	#pragma region FunctionSpecialization
 	#pragma region bool
 		/// <summary>
-		/// create a wstring which shows the Entry name, value and is also centered
+		/// append the Entry (name, value and centered) to a builder
 		/// </summary>
+		/// <param name="output">- builder to append to</param>
 		/// <param name="selected">- if the entry is selected or not</param>
-		/// <returns>wstring which shows the Entry name, value and is also centered</returns>
-		std::wstring MenuEntry<bool>::EntryString(bool selected)
+		void MenuEntry<bool>::AppendEntryString(NosStdLib::String::Builder<wchar_t>& output, bool selected)
 		{
 			*MenuConsoleSizeStruct = NosStdLib::Global::Console::GetConsoleSize(*MenuConsoleHandle, MenuConsoleScreenBI); /* Update values */
 
-			std::wstring output = (selected ? 
-								   std::wstring(((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2) - 3, ' ') + L">> " + EntryName + std::wstring(4, ' ') + (*TypePointerStore ? L"[X]" : L"[ ]") +L" <<" :
-								   std::wstring(((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2) - 0, ' ') + L"" + EntryName + std::wstring(4, ' ') + (*TypePointerStore ? L"[X]" : L"[ ]") + L"");
-			output += std::wstring(max((MenuConsoleSizeStruct->Columns - (output.size() + ((MenuConsoleSizeStruct->Columns / 2) - output.size() / 2))), 0), L' ') + L'\n';
-			return output;
+			int SpaceLenght = ((MenuConsoleSizeStruct->Columns / 2) - (int)EntryName.GetSize() / 2);
+			size_t lineStart = output.GetSize();
+			output.AppendRepeat(L' ', SpaceLenght - (selected ? 3 : 0)).Append(selected ? L">> " : L"").Append(EntryName).AppendRepeat(L' ', 4)
+				  .Append(*TypePointerStore ? L"[X]" : L"[ ]").Append(selected ? L" <<" : L"");
+			AppendEntryEnd(output, lineStart);
 		}
 
 		/// <summary>
@@ -419,19 +470,18 @@ namespace NosStdLib
 
 	#pragma region int
 		/// <summary>
-		/// create a wstring which shows the Entry name, value and is also centered
+		/// append the Entry (name, value and centered) to a builder
 		/// </summary>
+		/// <param name="output">- builder to append to</param>
 		/// <param name="selected">- if the entry is selected or not</param>
-		/// <returns>wstring which shows the Entry name, value and is also centered</returns>
-		std::wstring MenuEntry<int>::EntryString(bool selected)
+		void MenuEntry<int>::AppendEntryString(NosStdLib::String::Builder<wchar_t>& output, bool selected)
 		{
 			*MenuConsoleSizeStruct = NosStdLib::Global::Console::GetConsoleSize(*MenuConsoleHandle, MenuConsoleScreenBI); /* Update values */
 
-			std::wstring output = (selected ? 
-								   std::wstring(((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2), ' ') + EntryName + std::wstring(4, ' ') + L"<" + std::to_wstring(*TypePointerStore) + L">" :
-								   std::wstring(((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2), ' ') + EntryName + std::wstring(4, ' ') + L"" + std::to_wstring(*TypePointerStore) + L"");
-			output += std::wstring(max((MenuConsoleSizeStruct->Columns - (output.size() + ((MenuConsoleSizeStruct->Columns / 2) - output.size() / 2))), 0), L' ') + L'\n';
-			return output;
+			int SpaceLenght = ((MenuConsoleSizeStruct->Columns / 2) - (int)EntryName.GetSize() / 2);
+			size_t lineStart = output.GetSize();
+			output.AppendRepeat(L' ', SpaceLenght).Append(EntryName).AppendRepeat(L' ', 4).AppendFormat(selected ? L"<{}>" : L"{}", *TypePointerStore);
+			AppendEntryEnd(output, lineStart);
 		}
 
 		/// <summary>
@@ -448,7 +498,7 @@ namespace NosStdLib
 				wchar_t ch;
 				bool ContinueIntType = true;
 
-				COORD NumberPosition = { (((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2) + EntryName.length() + 5), (inputStruct->CurrentIndex + inputStruct->TitleSize) };
+				COORD NumberPosition = { (((MenuConsoleSizeStruct->Columns / 2) - EntryName.GetSize() / 2) + EntryName.GetSize() + 5), (inputStruct->CurrentIndex + inputStruct->TitleSize) };
 
 				SetConsoleCursorPosition(*MenuConsoleHandle, NumberPosition);
 				NosStdLib::Global::Console::ShowCaret(true);
@@ -486,21 +536,9 @@ namespace NosStdLib
 
 				if (!NewInt.empty())
 				{
-					try
-					{
-						*TypePointerStore = std::stoi(NewInt);
-					}
-					catch (const std::out_of_range& ex)
-					{
-						if (NewInt[0] == '-')
-							*TypePointerStore = INT_MIN;
-						else
-							*TypePointerStore = INT_MAX;
-					}
-					catch (...)
-					{
-						/* if any other exception, do nothing */
-					}
+					/* parse in one pass, too big numbers get clamped and anything invalid (just "-") leaves the value as is */
+					if (NosStdLib::String::ParseInteger(NewInt, *TypePointerStore) == NosStdLib::String::ParseStatus::Overflow)
+						*TypePointerStore = (NewInt[0] == L'-' ? INT_MIN : INT_MAX);
 				}
 
 				SetConsoleCursorPosition(*MenuConsoleHandle, { 0, (SHORT)(inputStruct->CurrentIndex + inputStruct->TitleSize) });
@@ -524,19 +562,20 @@ namespace NosStdLib
 
 	#pragma region DynamicMenu
 		/// <summary>
-		/// create a wstring which shows the Entry name, value and is also centered
+		/// append the Entry (name, value and centered) to a builder
 		/// </summary>
+		/// <param name="output">- builder to append to</param>
 		/// <param name="selected">- if the entry is selected or not</param>
-		/// <returns>wstring which shows the Entry name, value and is also centered</returns>
-		std::wstring MenuEntry<DynamicMenu>::EntryString(bool selected)
+		void MenuEntry<DynamicMenu>::AppendEntryString(NosStdLib::String::Builder<wchar_t>& output, bool selected)
 		{
+			static const std::wstring submenuColor = NosStdLib::TextColor::NosRGB(212, 155, 55).MakeANSICode<wchar_t>(); /* made once instead of every draw */
+
 			*MenuConsoleSizeStruct = NosStdLib::Global::Console::GetConsoleSize(*MenuConsoleHandle, MenuConsoleScreenBI); /* Update values */
 
-			std::wstring output = (selected ? 
-								   std::wstring(((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2) - 3, ' ') + NosStdLib::TextColor::NosRGB(212, 155, 55).MakeANSICode<wchar_t>() + L">> " + EntryName + L" <<" :
-								   std::wstring(((MenuConsoleSizeStruct->Columns / 2) - EntryName.length() / 2) - 0, ' ') + NosStdLib::TextColor::NosRGB(212, 155, 55).MakeANSICode<wchar_t>() + L"" + EntryName + L"");
-			output += std::wstring(max((MenuConsoleSizeStruct->Columns - (output.size() + ((MenuConsoleSizeStruct->Columns / 2) - output.size() / 2))), 0), L' ') + L"\033[0m\n";
-			return output;
+			int SpaceLenght = ((MenuConsoleSizeStruct->Columns / 2) - (int)EntryName.GetSize() / 2);
+			size_t lineStart = output.GetSize();
+			output.AppendRepeat(L' ', SpaceLenght - (selected ? 3 : 0)).Append(submenuColor).Append(selected ? L">> " : L"").Append(EntryName).Append(selected ? L" <<" : L"");
+			AppendEntryEnd(output, lineStart, L"\033[0m\n");
 		}
 
 		/// <summary>
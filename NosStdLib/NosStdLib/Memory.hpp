@@ -0,0 +1,383 @@
+#ifndef _MEMORY_NOSSTDLIB_HPP_
+#define _MEMORY_NOSSTDLIB_HPP_
+
+#include <memory_resource>
+#include <cstddef>
+#include <stdint.h>
+
+namespace NosStdLib
+{
+	/// <summary>
+	/// namespace for items which are related to memory management (memory resources which can be used with PmrDynamicArray or any std::pmr container)
+	/// </summary>
+	namespace Memory
+	{
+		/// <summary>
+		/// Bump/arena memory resource. allocating just moves a pointer forward and deallocating does nothing,
+		/// all the memory gets freed at once with Reset (or when the arena gets destroyed). NOT thread safe
+		/// </summary>
+		class ArenaResource : public std::pmr::memory_resource
+		{
+		private:
+			/// <summary>
+			/// header at the start of every chunk, links all the chunks together
+			/// </summary>
+			struct ChunkHeader
+			{
+				ChunkHeader* Next;	/* the chunk allocated before this one */
+				size_t Size;		/* size of the chunk including the header */
+			};
+
+			std::pmr::memory_resource* Upstream;	/* resource which the chunks get allocated from */
+			ChunkHeader* CurrentChunk;				/* newest chunk, allocations come from this one */
+			unsigned char* CurrentPointer;			/* next free byte in the current chunk */
+			unsigned char* CurrentEnd;				/* end of the current chunk */
+			size_t NextChunkSize;					/* size of the next chunk which gets allocated (doubles each time) */
+			size_t BytesAllocated;					/* bytes handed out since the last reset */
+
+			/// <summary>
+			/// Allocates a new chunk which fits atleast the wanted amount of bytes and makes it the current chunk
+			/// </summary>
+			/// <param name="minimumBytes">- the amount of bytes which has to fit (header not included)</param>
+			void AddChunk(const size_t& minimumBytes)
+			{
+				size_t chunkSize = NextChunkSize;
+				if (chunkSize < minimumBytes + sizeof(ChunkHeader))
+					chunkSize = minimumBytes + sizeof(ChunkHeader);
+
+				ChunkHeader* newChunk = (ChunkHeader*)Upstream->allocate(chunkSize, alignof(std::max_align_t));
+				newChunk->Next = CurrentChunk;
+				newChunk->Size = chunkSize;
+
+				CurrentChunk = newChunk;
+				CurrentPointer = (unsigned char*)(newChunk + 1);
+				CurrentEnd = (unsigned char*)newChunk + chunkSize;
+				NextChunkSize *= 2;
+			}
+
+			/// <summary>
+			/// Frees all chunks starting from the chunk given
+			/// </summary>
+			/// <param name="chunk">- the first chunk to free</param>
+			void FreeChunks(ChunkHeader* chunk)
+			{
+				while (chunk != nullptr)
+				{
+					ChunkHeader* next = chunk->Next;
+					Upstream->deallocate(chunk, chunk->Size, alignof(std::max_align_t));
+					chunk = next;
+				}
+			}
+		protected:
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				uintptr_t alignedPointer = ((uintptr_t)CurrentPointer + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+
+				if (CurrentChunk == nullptr || alignedPointer + bytes > (uintptr_t)CurrentEnd)
+				{
+					AddChunk(bytes + alignment);
+					alignedPointer = ((uintptr_t)CurrentPointer + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+				}
+
+				CurrentPointer = (unsigned char*)(alignedPointer + bytes);
+				BytesAllocated += bytes;
+				return (void*)alignedPointer;
+			}
+
+			void do_deallocate(void* /*pointer*/, size_t /*bytes*/, size_t /*alignment*/) override
+			{
+				/* Does nothing, memory gets freed with Reset */
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+		public:
+			/// <summary>
+			/// Create arena
+			/// </summary>
+			/// <param name="initialChunkSize">(default = 65536) - size of the first chunk in bytes</param>
+			/// <param name="upstream">(default = std::pmr::get_default_resource()) - resource which the chunks get allocated from</param>
+			ArenaResource(const size_t& initialChunkSize = 65536, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+			{
+				Upstream = upstream;
+				CurrentChunk = nullptr;
+				CurrentPointer = CurrentEnd = nullptr;
+				NextChunkSize = (initialChunkSize > sizeof(ChunkHeader) ? initialChunkSize : sizeof(ChunkHeader) * 2);
+				BytesAllocated = 0;
+			}
+
+			ArenaResource(const ArenaResource&) = delete;
+			ArenaResource& operator=(const ArenaResource&) = delete;
+
+			/// Free all the chunks
+			~ArenaResource()
+			{
+				FreeChunks(CurrentChunk);
+			}
+
+			/// <summary>
+			/// Frees everything allocated from the arena at once. keeps the newest (biggest) chunk so the next pass doesn't have to allocate.
+			/// WARNING: objects inside the arena don't get destroyed, only use for objects which don't need destroying or have already been destroyed
+			/// </summary>
+			void Reset()
+			{
+				if (CurrentChunk != nullptr)
+				{
+					FreeChunks(CurrentChunk->Next);
+					CurrentChunk->Next = nullptr;
+					CurrentPointer = (unsigned char*)(CurrentChunk + 1);
+				}
+				BytesAllocated = 0;
+			}
+
+			/// <summary>
+			/// Frees everything allocated from the arena and gives all the chunks back to the upstream resource
+			/// </summary>
+			void Release()
+			{
+				FreeChunks(CurrentChunk);
+				CurrentChunk = nullptr;
+				CurrentPointer = CurrentEnd = nullptr;
+				BytesAllocated = 0;
+			}
+
+			/// <summary>
+			/// Returns the amount of bytes handed out since the last reset
+			/// </summary>
+			/// <returns>bytes allocated</returns>
+			size_t GetBytesAllocated() const
+			{
+				return BytesAllocated;
+			}
+		};
+
+		/// <summary>
+		/// Fixed size pool memory resource. every allocation which fits into BlockSize gets a block from a free list (O(1) allocate and deallocate),
+		/// bigger allocations go straight to the upstream resource. NOT thread safe
+		/// </summary>
+		class PoolResource : public std::pmr::memory_resource
+		{
+		private:
+			/// <summary>
+			/// a free block, stores the pointer to the next free block inside of itself
+			/// </summary>
+			struct FreeBlock
+			{
+				FreeBlock* Next; /* next free block */
+			};
+
+			/// <summary>
+			/// header at the start of every chunk, links all the chunks together
+			/// </summary>
+			struct ChunkHeader
+			{
+				ChunkHeader* Next;	/* the chunk allocated before this one */
+			};
+
+			std::pmr::memory_resource* Upstream;	/* resource which the chunks and oversized allocations get allocated from */
+			size_t BlockSize;						/* size of a single block (rounded up to max alignment) */
+			size_t BlocksPerChunk;					/* amount of blocks in each chunk */
+			FreeBlock* FreeList;					/* first free block */
+			ChunkHeader* Chunks;					/* newest chunk */
+
+			/// <summary>
+			/// Returns the size of a chunk in bytes (header included)
+			/// </summary>
+			/// <returns>chunk size</returns>
+			size_t ChunkSize()
+			{
+				return alignof(std::max_align_t) + BlockSize * BlocksPerChunk;
+			}
+
+			/// <summary>
+			/// Allocates a new chunk and puts all its blocks onto the free list
+			/// </summary>
+			void AddChunk()
+			{
+				ChunkHeader* newChunk = (ChunkHeader*)Upstream->allocate(ChunkSize(), alignof(std::max_align_t));
+				newChunk->Next = Chunks;
+				Chunks = newChunk;
+
+				unsigned char* firstBlock = (unsigned char*)newChunk + alignof(std::max_align_t); /* header takes a full alignment slot so blocks stay aligned */
+				for (size_t i = BlocksPerChunk; i > 0; i--)
+				{
+					FreeBlock* block = (FreeBlock*)(firstBlock + (i - 1) * BlockSize);
+					block->Next = FreeList;
+					FreeList = block;
+				}
+			}
+		protected:
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				if (bytes > BlockSize || alignment > alignof(std::max_align_t))
+					return Upstream->allocate(bytes, alignment);
+
+				if (FreeList == nullptr)
+					AddChunk();
+
+				FreeBlock* block = FreeList;
+				FreeList = block->Next;
+				return block;
+			}
+
+			void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+			{
+				if (bytes > BlockSize || alignment > alignof(std::max_align_t))
+				{
+					Upstream->deallocate(pointer, bytes, alignment);
+					return;
+				}
+
+				FreeBlock* block = (FreeBlock*)pointer;
+				block->Next = FreeList;
+				FreeList = block;
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+		public:
+			/// <summary>
+			/// Create pool
+			/// </summary>
+			/// <param name="blockSize">- size of each block in bytes (allocations up to this size come from the pool)</param>
+			/// <param name="blocksPerChunk">(default = 256) - amount of blocks to allocate at once when the pool runs out</param>
+			/// <param name="upstream">(default = std::pmr::get_default_resource()) - resource which the chunks get allocated from</param>
+			PoolResource(const size_t& blockSize, const size_t& blocksPerChunk = 256, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+			{
+				Upstream = upstream;
+				/* round up so every block stays aligned and can hold the free list pointer */
+				BlockSize = (blockSize > sizeof(FreeBlock) ? blockSize : sizeof(FreeBlock));
+				BlockSize = ((BlockSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t);
+				BlocksPerChunk = (blocksPerChunk > 0 ? blocksPerChunk : 1);
+				FreeList = nullptr;
+				Chunks = nullptr;
+			}
+
+			PoolResource(const PoolResource&) = delete;
+			PoolResource& operator=(const PoolResource&) = delete;
+
+			/// Free all the chunks
+			~PoolResource()
+			{
+				Reset();
+			}
+
+			/// <summary>
+			/// Gives all the chunks back to the upstream resource at once.
+			/// WARNING: every block becomes invalid, objects inside the pool don't get destroyed
+			/// </summary>
+			void Reset()
+			{
+				while (Chunks != nullptr)
+				{
+					ChunkHeader* next = Chunks->Next;
+					Upstream->deallocate(Chunks, ChunkSize(), alignof(std::max_align_t));
+					Chunks = next;
+				}
+				FreeList = nullptr;
+			}
+
+			/// <summary>
+			/// Returns the block size
+			/// </summary>
+			/// <returns>block size in bytes</returns>
+			size_t GetBlockSize() const
+			{
+				return BlockSize;
+			}
+		};
+
+		/// <summary>
+		/// Memory resource which passes everything to the upstream resource and counts the allocations.
+		/// meant for checking how often something allocates (e.g. if reusing an array allocates or not)
+		/// </summary>
+		class CountingResource : public std::pmr::memory_resource
+		{
+		private:
+			std::pmr::memory_resource* Upstream;	/* resource which does the actual allocating */
+			size_t AllocationCount;					/* amount of allocate calls */
+			size_t DeallocationCount;				/* amount of deallocate calls */
+			size_t BytesInUse;						/* bytes allocated and not yet deallocated */
+			size_t TotalBytesAllocated;				/* bytes allocated in total */
+		protected:
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				AllocationCount++;
+				BytesInUse += bytes;
+				TotalBytesAllocated += bytes;
+				return Upstream->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+			{
+				DeallocationCount++;
+				BytesInUse -= bytes;
+				Upstream->deallocate(pointer, bytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+		public:
+			/// <summary>
+			/// Create counting resource
+			/// </summary>
+			/// <param name="upstream">(default = std::pmr::get_default_resource()) - resource which does the actual allocating</param>
+			CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+			{
+				Upstream = upstream;
+				ResetCounters();
+			}
+
+			/// <summary>
+			/// Sets all the counters back to 0
+			/// </summary>
+			void ResetCounters()
+			{
+				AllocationCount = DeallocationCount = BytesInUse = TotalBytesAllocated = 0;
+			}
+
+			/// <summary>
+			/// Returns the amount of allocations
+			/// </summary>
+			/// <returns>allocation count</returns>
+			size_t GetAllocationCount() const
+			{
+				return AllocationCount;
+			}
+
+			/// <summary>
+			/// Returns the amount of deallocations
+			/// </summary>
+			/// <returns>deallocation count</returns>
+			size_t GetDeallocationCount() const
+			{
+				return DeallocationCount;
+			}
+
+			/// <summary>
+			/// Returns the amount of bytes which are currently allocated
+			/// </summary>
+			/// <returns>bytes in use</returns>
+			size_t GetBytesInUse() const
+			{
+				return BytesInUse;
+			}
+
+			/// <summary>
+			/// Returns the amount of bytes allocated in total
+			/// </summary>
+			/// <returns>total bytes allocated</returns>
+			size_t GetTotalBytesAllocated() const
+			{
+				return TotalBytesAllocated;
+			}
+		};
+	}
+}
+#endif
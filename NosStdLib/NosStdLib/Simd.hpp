@@ -0,0 +1,24 @@
+#ifndef _SIMD_NOSSTDLIB_HPP_
+#define _SIMD_NOSSTDLIB_HPP_
+
+/*
+Compile time detection of the vector instruction sets which the kernels in DynamicArray.hpp and String.hpp can use.
+SSE2 is always there on x64, AVX2 only gets used if the compiler is allowed to use it (MSVC: /arch:AVX2, GCC/Clang: -mavx2).
+define NOSSTDLIB_NO_SIMD before including any NosStdLib header to force the scalar versions.
+*/
+
+#if !defined(NOSSTDLIB_NO_SIMD)
+	#if defined(__AVX2__)
+		#define NOSSTDLIB_AVX2
+	#endif
+
+	#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define NOSSTDLIB_SSE2
+	#endif
+#endif
+
+#if defined(NOSSTDLIB_SSE2) || defined(NOSSTDLIB_AVX2)
+	#include <immintrin.h>
+#endif
+
+#endif
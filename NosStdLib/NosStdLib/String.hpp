@@ -10,6 +10,25 @@
 #include <algorithm>
 #include <iterator>
 #include <set>
+#include <limits>
+#include <charconv>
+#include <type_traits>
+#include <bit>
+#include <stdint.h>
+#include <string_view>
+#include <array>
+#include <span>
+#include <cstring>
+#include <cwchar>
+#include <stdexcept>
+#include <format>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <new>
+
+#include "Simd.hpp"
+#include "Memory.hpp"
 
 namespace NosStdLib
 {
@@ -18,242 +37,3156 @@ namespace NosStdLib
 	/// </summary>
 	namespace String
 	{
+	#pragma region String Kernels
+		/// <summary>
+		/// namespace for the low level (vectorized where possible) loops which the string functions are built on
+		/// </summary>
+		namespace Kernels
+		{
+			/// <summary>
+			/// Counts how many characters from the start are ASCII digits ('0' to '9'). checks 16 bytes at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <returns>length of the digit run at the start</returns>
+			template <typename CharT>
+			constexpr size_t CountLeadingDigits(const CharT* first, const CharT* last)
+			{
+				const CharT* current = first;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					if constexpr (sizeof(CharT) == 1)
+					{
+						const __m128i zero = _mm_set1_epi8('0'), nine = _mm_set1_epi8(9);
+						for (; last - current >= 16; current += 16)
+						{
+							__m128i offset = _mm_sub_epi8(_mm_loadu_si128((const __m128i*)current), zero);
+							unsigned digitMask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset)); /* digit if (c - '0') <= 9 unsigned */
+							if (digitMask != 0xFFFF)
+								return (current - first) + std::countr_zero(~digitMask);
+						}
+					}
+					else if constexpr (sizeof(CharT) == 2)
+					{
+						const __m128i zero = _mm_set1_epi16('0'), belowZero = _mm_set1_epi16(-1), aboveNine = _mm_set1_epi16(10);
+						for (; last - current >= 8; current += 8)
+						{
+							__m128i offset = _mm_sub_epi16(_mm_loadu_si128((const __m128i*)current), zero);
+							__m128i isDigit = _mm_and_si128(_mm_cmpgt_epi16(offset, belowZero), _mm_cmplt_epi16(offset, aboveNine));
+							unsigned digitMask = (unsigned)_mm_movemask_epi8(isDigit);
+							if (digitMask != 0xFFFF)
+								return (current - first) + std::countr_zero(~digitMask) / 2;
+						}
+					}
+					else if constexpr (sizeof(CharT) == 4)
+					{
+						const __m128i zero = _mm_set1_epi32('0'), belowZero = _mm_set1_epi32(-1), aboveNine = _mm_set1_epi32(10);
+						for (; last - current >= 4; current += 4)
+						{
+							__m128i offset = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)current), zero);
+							__m128i isDigit = _mm_and_si128(_mm_cmpgt_epi32(offset, belowZero), _mm_cmplt_epi32(offset, aboveNine));
+							unsigned digitMask = (unsigned)_mm_movemask_epi8(isDigit);
+							if (digitMask != 0xFFFF)
+								return (current - first) + std::countr_zero(~digitMask) / 4;
+						}
+					}
+				}
+			#endif
+
+				while (current != last && *current >= (CharT)'0' && *current <= (CharT)'9')
+				{
+					current++;
+				}
+				return current - first;
+			}
+
+			/// <summary>
+			/// Gets the decimal exponent of the first non zero digit of an already checked float ("123.4" -> 2, "0.05" -> -2, "1e-400" -> -400).
+			/// ParseFloat uses it to tell if an out of range number was too big or too close to 0, the exponent part saturates so huge exponents can't overflow
+			/// </summary>
+			/// <param name="first">- pointer to the first character (no sign)</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <returns>decimal exponent (0 if every digit is 0)</returns>
+			inline long long GetDecimalExponent(const char* first, const char* last)
+			{
+				const char* current = first;
+				long long exponent = 0;
+				bool foundDigit = false;
+
+				for (; current != last && *current >= '0' && *current <= '9'; current++) /* integer part, every digit after the first non zero one adds 1 */
+				{
+					if (foundDigit)
+						exponent++;
+					else if (*current != '0')
+						foundDigit = true;
+				}
+				if (current != last && *current == '.')
+				{
+					for (current++; current != last && *current >= '0' && *current <= '9'; current++) /* fraction part, every leading 0 takes 1 away */
+					{
+						if (foundDigit)
+							continue;
+						exponent--;
+						if (*current != '0')
+							foundDigit = true;
+					}
+				}
+				if (!foundDigit)
+					return 0;
+
+				if (current != last && (*current == 'e' || *current == 'E'))
+				{
+					current++;
+					bool negative = (current != last && *current == '-');
+					if (current != last && (*current == '-' || *current == '+'))
+						current++;
+
+					long long explicitExponent = 0;
+					for (; current != last && *current >= '0' && *current <= '9'; current++)
+						explicitExponent = (std::min)(explicitExponent * 10 + (*current - '0'), 100000000LL);
+					exponent += (negative ? -explicitExponent : explicitExponent);
+				}
+				return exponent;
+			}
+
+			/// <summary>
+			/// Counts how many code units from the start are ASCII (below 0x80). checks 16 bytes at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first code unit</param>
+			/// <param name="last">- pointer past the last code unit</param>
+			/// <returns>length of the ASCII run at the start</returns>
+			template <typename CharT>
+			constexpr size_t CountLeadingAscii(const CharT* first, const CharT* last)
+			{
+				const CharT* current = first;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					if constexpr (sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4)
+					{
+						constexpr size_t unitsPerBlock = 16 / sizeof(CharT);
+						/* a unit is ASCII if every bit from 0x80 up is clear, so mask those bits and look for non zero bytes */
+						const __m128i highBits = (sizeof(CharT) == 1 ? _mm_set1_epi8((char)0x80) : (sizeof(CharT) == 2 ? _mm_set1_epi16((short)0xFF80) : _mm_set1_epi32((int)0xFFFFFF80)));
+						for (; (size_t)(last - current) >= unitsPerBlock; current += unitsPerBlock)
+						{
+							__m128i block = _mm_and_si128(_mm_loadu_si128((const __m128i*)current), highBits);
+							unsigned nonAsciiMask = ~(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128())) & 0xFFFF;
+							if (nonAsciiMask != 0)
+								return (current - first) + std::countr_zero(nonAsciiMask) / sizeof(CharT);
+						}
+					}
+				}
+			#endif
+
+				while (current != last && (std::make_unsigned_t<CharT>)*current < 0x80)
+				{
+					current++;
+				}
+				return current - first;
+			}
+
+			/// <summary>
+			/// Finds the first occurrence of a character, uses memchr/wmemchr (which are vectorized by the C runtime) where the type allows it, char_traits::find at compile time
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <param name="character">- character to look for</param>
+			/// <returns>pointer to the character, nullptr if it isn't there</returns>
+			template <typename CharT>
+			constexpr const CharT* FindCharacter(const CharT* first, const CharT* last, const CharT& character)
+			{
+				if (first == last)
+					return nullptr;
+				else if (std::is_constant_evaluated())
+					return std::char_traits<CharT>::find(first, last - first, character);
+				else if constexpr (sizeof(CharT) == 1)
+					return (const CharT*)std::memchr(first, (unsigned char)character, last - first);
+				else if constexpr (std::is_same_v<CharT, wchar_t>)
+					return std::wmemchr(first, character, last - first);
+				else
+					return std::char_traits<CharT>::find(first, last - first, character);
+			}
+
+			/// <summary>
+			/// Counts how many characters from the start are printable ASCII (' ' to '~'). checks 16 bytes at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <returns>length of the printable run at the start</returns>
+			template <typename CharT>
+			constexpr size_t CountLeadingPrintableAscii(const CharT* first, const CharT* last)
+			{
+				const CharT* current = first;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					if constexpr (sizeof(CharT) == 1)
+					{
+						/* flipping the sign bit turns the unsigned range 0x20-0x7E into the signed range -96 to -2 */
+						const __m128i signFlip = _mm_set1_epi8((char)0x80), belowSpace = _mm_set1_epi8(0x20 - 0x80 - 1), aboveTilde = _mm_set1_epi8(0x7E - 0x80 + 1);
+						for (; last - current >= 16; current += 16)
+						{
+							__m128i block = _mm_xor_si128(_mm_loadu_si128((const __m128i*)current), signFlip);
+							unsigned printableMask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(block, belowSpace), _mm_cmplt_epi8(block, aboveTilde)));
+							if (printableMask != 0xFFFF)
+								return (current - first) + std::countr_zero(~printableMask);
+						}
+					}
+					else if constexpr (sizeof(CharT) == 2)
+					{
+						const __m128i belowSpace = _mm_set1_epi16(0x20 - 1), aboveTilde = _mm_set1_epi16(0x7E + 1);
+						for (; last - current >= 8; current += 8)
+						{
+							__m128i block = _mm_loadu_si128((const __m128i*)current);
+							unsigned printableMask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi16(block, belowSpace), _mm_cmplt_epi16(block, aboveTilde)));
+							if (printableMask != 0xFFFF)
+								return (current - first) + std::countr_zero(~printableMask) / 2;
+						}
+					}
+					else if constexpr (sizeof(CharT) == 4)
+					{
+						const __m128i belowSpace = _mm_set1_epi32(0x20 - 1), aboveTilde = _mm_set1_epi32(0x7E + 1);
+						for (; last - current >= 4; current += 4)
+						{
+							__m128i block = _mm_loadu_si128((const __m128i*)current);
+							unsigned printableMask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi32(block, belowSpace), _mm_cmplt_epi32(block, aboveTilde)));
+							if (printableMask != 0xFFFF)
+								return (current - first) + std::countr_zero(~printableMask) / 4;
+						}
+					}
+				}
+			#endif
+
+				while (current != last && *current >= (CharT)' ' && *current <= (CharT)'~')
+				{
+					current++;
+				}
+				return current - first;
+			}
+
+			/// <summary>
+			/// Copies a run of ASCII code units into a different sized character type. widens/narrows 16 units at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharTo">- output character type</typeparam>
+			/// <typeparam name="CharFrom">- input character type</typeparam>
+			/// <param name="from">- pointer to the input, every unit has to be ASCII</param>
+			/// <param name="count">- amount of units</param>
+			/// <param name="to">- pointer to the output, needs space for count units</param>
+			template <typename CharTo, typename CharFrom>
+			void CopyAscii(const CharFrom* from, const size_t& count, CharTo* to)
+			{
+				size_t i = 0;
+
+			#if defined(NOSSTDLIB_SSE2)
+				const __m128i zero = _mm_setzero_si128();
+				if constexpr (sizeof(CharFrom) == 1 && sizeof(CharTo) == 2)
+				{
+					for (; i + 16 <= count; i += 16)
+					{
+						__m128i block = _mm_loadu_si128((const __m128i*)(from + i));
+						_mm_storeu_si128((__m128i*)(to + i), _mm_unpacklo_epi8(block, zero));
+						_mm_storeu_si128((__m128i*)(to + i + 8), _mm_unpackhi_epi8(block, zero));
+					}
+				}
+				else if constexpr (sizeof(CharFrom) == 1 && sizeof(CharTo) == 4)
+				{
+					for (; i + 16 <= count; i += 16)
+					{
+						__m128i block = _mm_loadu_si128((const __m128i*)(from + i));
+						__m128i low = _mm_unpacklo_epi8(block, zero), high = _mm_unpackhi_epi8(block, zero);
+						_mm_storeu_si128((__m128i*)(to + i), _mm_unpacklo_epi16(low, zero));
+						_mm_storeu_si128((__m128i*)(to + i + 4), _mm_unpackhi_epi16(low, zero));
+						_mm_storeu_si128((__m128i*)(to + i + 8), _mm_unpacklo_epi16(high, zero));
+						_mm_storeu_si128((__m128i*)(to + i + 12), _mm_unpackhi_epi16(high, zero));
+					}
+				}
+				else if constexpr (sizeof(CharFrom) == 2 && sizeof(CharTo) == 1)
+				{
+					for (; i + 16 <= count; i += 16)
+					{
+						__m128i low = _mm_loadu_si128((const __m128i*)(from + i)), high = _mm_loadu_si128((const __m128i*)(from + i + 8));
+						_mm_storeu_si128((__m128i*)(to + i), _mm_packus_epi16(low, high));
+					}
+				}
+				else if constexpr (sizeof(CharFrom) == 4 && sizeof(CharTo) == 1)
+				{
+					for (; i + 16 <= count; i += 16)
+					{
+						/* values are below 0x80 so the signed saturation of packs never kicks in */
+						__m128i low = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(from + i)), _mm_loadu_si128((const __m128i*)(from + i + 4)));
+						__m128i high = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(from + i + 8)), _mm_loadu_si128((const __m128i*)(from + i + 12)));
+						_mm_storeu_si128((__m128i*)(to + i), _mm_packus_epi16(low, high));
+					}
+				}
+				else if constexpr (sizeof(CharFrom) == 2 && sizeof(CharTo) == 4)
+				{
+					for (; i + 8 <= count; i += 8)
+					{
+						__m128i block = _mm_loadu_si128((const __m128i*)(from + i));
+						_mm_storeu_si128((__m128i*)(to + i), _mm_unpacklo_epi16(block, zero));
+						_mm_storeu_si128((__m128i*)(to + i + 4), _mm_unpackhi_epi16(block, zero));
+					}
+				}
+				else if constexpr (sizeof(CharFrom) == 4 && sizeof(CharTo) == 2)
+				{
+					for (; i + 8 <= count; i += 8)
+					{
+						__m128i low = _mm_loadu_si128((const __m128i*)(from + i)), high = _mm_loadu_si128((const __m128i*)(from + i + 4));
+						_mm_storeu_si128((__m128i*)(to + i), _mm_packs_epi32(low, high));
+					}
+				}
+			#endif
+
+				for (; i < count; i++)
+				{
+					to[i] = (CharTo)from[i];
+				}
+			}
+
+			/// <summary>
+			/// Decodes 1 code point and moves current past it. the encoding comes from the code unit size (1 = UTF-8, 2 = UTF-16, 4 = UTF-32).
+			/// if the sequence is invalid, current gets moved past the invalid part (atleast 1 unit) so decoding can carry on after it
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="current">- pointer to the first unit of the sequence, gets moved past it</param>
+			/// <param name="last">- pointer past the last code unit</param>
+			/// <param name="codePoint">- the decoded code point</param>
+			/// <returns>if the sequence was valid</returns>
+			template <typename CharT>
+			constexpr bool DecodeCodePoint(const CharT*& current, const CharT* last, char32_t& codePoint)
+			{
+				if constexpr (sizeof(CharT) == 1)
+				{
+					uint8_t lead = (uint8_t)*current++;
+					if (lead < 0x80)
+					{
+						codePoint = lead;
+						return true;
+					}
+
+					int length;
+					if (lead >= 0xC2 && lead <= 0xDF)
+					{
+						length = 2;
+						codePoint = lead & 0x1F;
+					}
+					else if (lead >= 0xE0 && lead <= 0xEF)
+					{
+						length = 3;
+						codePoint = lead & 0x0F;
+					}
+					else if (lead >= 0xF0 && lead <= 0xF4)
+					{
+						length = 4;
+						codePoint = lead & 0x07;
+					}
+					else /* continuation byte, overlong 2 byte lead (C0, C1) or past U+10FFFF */
+					{
+						return false;
+					}
+
+					for (int i = 1; i < length; i++)
+					{
+						if (current == last)
+						{
+							return false;
+						}
+
+						/* the second byte has a smaller range after E0, ED, F0 and F4 (rules out overlongs, surrogates and past U+10FFFF) */
+						uint8_t next = (uint8_t)*current, low = 0x80, high = 0xBF;
+						if (i == 1)
+						{
+							if (lead == 0xE0) low = 0xA0;
+							else if (lead == 0xED) high = 0x9F;
+							else if (lead == 0xF0) low = 0x90;
+							else if (lead == 0xF4) high = 0x8F;
+						}
+
+						if (next < low || next > high)
+						{
+							return false;
+						}
+						codePoint = (codePoint << 6) | (next & 0x3F);
+						current++;
+					}
+					return true;
+				}
+				else if constexpr (sizeof(CharT) == 2)
+				{
+					char16_t unit = (char16_t)*current++;
+					if (unit < 0xD800 || unit > 0xDFFF)
+					{
+						codePoint = unit;
+						return true;
+					}
+
+					/* needs a high surrogate followed by a low surrogate */
+					if (unit >= 0xDC00 || current == last || (char16_t)*current < 0xDC00 || (char16_t)*current > 0xDFFF)
+					{
+						return false;
+					}
+					codePoint = 0x10000 + (((char32_t)unit - 0xD800) << 10) + ((char32_t)(char16_t)*current++ - 0xDC00);
+					return true;
+				}
+				else
+				{
+					codePoint = (char32_t)*current++;
+					return (codePoint < 0xD800 || (codePoint > 0xDFFF && codePoint <= 0x10FFFF));
+				}
+			}
+
+			/// <summary>
+			/// Gets how many code units a code point takes up
+			/// </summary>
+			/// <typeparam name="CharT">- character type (1 = UTF-8, 2 = UTF-16, 4 = UTF-32)</typeparam>
+			/// <param name="codePoint">- valid code point</param>
+			/// <returns>amount of code units</returns>
+			template <typename CharT>
+			constexpr size_t EncodedLength(const char32_t& codePoint)
+			{
+				if constexpr (sizeof(CharT) == 1)
+				{
+					return (codePoint < 0x80 ? 1 : (codePoint < 0x800 ? 2 : (codePoint < 0x10000 ? 3 : 4)));
+				}
+				else if constexpr (sizeof(CharT) == 2)
+				{
+					return (codePoint < 0x10000 ? 1 : 2);
+				}
+				else
+				{
+					return 1;
+				}
+			}
+
+			/// <summary>
+			/// Encodes 1 code point and moves output past it
+			/// </summary>
+			/// <typeparam name="CharT">- character type (1 = UTF-8, 2 = UTF-16, 4 = UTF-32)</typeparam>
+			/// <param name="output">- where to write the code units, gets moved past them</param>
+			/// <param name="codePoint">- valid code point</param>
+			template <typename CharT>
+			constexpr void EncodeCodePoint(CharT*& output, const char32_t& codePoint)
+			{
+				if constexpr (sizeof(CharT) == 1)
+				{
+					if (codePoint < 0x80)
+					{
+						*output++ = (CharT)codePoint;
+					}
+					else if (codePoint < 0x800)
+					{
+						*output++ = (CharT)(0xC0 | (codePoint >> 6));
+						*output++ = (CharT)(0x80 | (codePoint & 0x3F));
+					}
+					else if (codePoint < 0x10000)
+					{
+						*output++ = (CharT)(0xE0 | (codePoint >> 12));
+						*output++ = (CharT)(0x80 | ((codePoint >> 6) & 0x3F));
+						*output++ = (CharT)(0x80 | (codePoint & 0x3F));
+					}
+					else
+					{
+						*output++ = (CharT)(0xF0 | (codePoint >> 18));
+						*output++ = (CharT)(0x80 | ((codePoint >> 12) & 0x3F));
+						*output++ = (CharT)(0x80 | ((codePoint >> 6) & 0x3F));
+						*output++ = (CharT)(0x80 | (codePoint & 0x3F));
+					}
+				}
+				else if constexpr (sizeof(CharT) == 2)
+				{
+					if (codePoint < 0x10000)
+					{
+						*output++ = (CharT)codePoint;
+					}
+					else
+					{
+						*output++ = (CharT)(0xD800 + ((codePoint - 0x10000) >> 10));
+						*output++ = (CharT)(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+					}
+				}
+				else
+				{
+					*output++ = (CharT)codePoint;
+				}
+			}
+
+			/// <summary>
+			/// Checks if a character is ASCII whitespace (space, \t, \n, \v, \f or \r)
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="character">- the character</param>
+			/// <returns>if it is whitespace</returns>
+			template <typename CharT>
+			constexpr bool IsAsciiWhitespace(const CharT& character)
+			{
+				return character == (CharT)' ' || (character >= (CharT)'\t' && character <= (CharT)'\r');
+			}
+
+			/// <summary>
+			/// Lower cases an ASCII letter, anything else stays the same
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="character">- the character</param>
+			/// <returns>the lower case character</returns>
+			template <typename CharT>
+			constexpr CharT ToLowerAscii(const CharT& character)
+			{
+				return (character >= (CharT)'A' && character <= (CharT)'Z' ? (CharT)(character | 0x20) : character);
+			}
+
+			/// <summary>
+			/// Upper cases an ASCII letter, anything else stays the same
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="character">- the character</param>
+			/// <returns>the upper case character</returns>
+			template <typename CharT>
+			constexpr CharT ToUpperAscii(const CharT& character)
+			{
+				return (character >= (CharT)'a' && character <= (CharT)'z' ? (CharT)(character & ~0x20) : character);
+			}
+
+		#if defined(NOSSTDLIB_SSE2)
+			/// <summary>
+			/// SSE2 helpers which pick the 8/16/32 bit instruction from the character size, so the kernels below don't need a branch per size.
+			/// the compare is signed, so code units with the top bit set (non ASCII bytes) never land in an ASCII range
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="value">- value to put into every lane</param>
+			/// <returns>the vector</returns>
+			template <typename CharT>
+			__m128i SimdBroadcast(const CharT& value)
+			{
+				if constexpr (sizeof(CharT) == 1)
+					return _mm_set1_epi8((char)value);
+				else if constexpr (sizeof(CharT) == 2)
+					return _mm_set1_epi16((short)value);
+				else
+					return _mm_set1_epi32((int)value);
+			}
+
+			/// <summary>
+			/// lanes which are equal become all 1s
+			/// </summary>
+			template <typename CharT>
+			__m128i SimdEqual(const __m128i& left, const __m128i& right)
+			{
+				if constexpr (sizeof(CharT) == 1)
+					return _mm_cmpeq_epi8(left, right);
+				else if constexpr (sizeof(CharT) == 2)
+					return _mm_cmpeq_epi16(left, right);
+				else
+					return _mm_cmpeq_epi32(left, right);
+			}
+
+			/// <summary>
+			/// lanes where left is bigger (signed) become all 1s
+			/// </summary>
+			template <typename CharT>
+			__m128i SimdGreater(const __m128i& left, const __m128i& right)
+			{
+				if constexpr (sizeof(CharT) == 1)
+					return _mm_cmpgt_epi8(left, right);
+				else if constexpr (sizeof(CharT) == 2)
+					return _mm_cmpgt_epi16(left, right);
+				else
+					return _mm_cmpgt_epi32(left, right);
+			}
+		#endif
+
+			/// <summary>
+			/// Counts how many times a character shows up. compares 16 bytes at a time with SSE2, every lane keeps its own count (a match is -1, so subtracting it adds 1)
+			/// and the lane counts get added up before they can overflow
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <param name="character">- character to count</param>
+			/// <returns>amount of times it shows up</returns>
+			template <typename CharT>
+			constexpr size_t CountCharacter(const CharT* first, const CharT* last, const CharT& character)
+			{
+				const CharT* current = first;
+				size_t count = 0;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					constexpr ptrdiff_t laneCount = 16 / sizeof(CharT);
+					constexpr int flushInterval = (sizeof(CharT) == 1 ? 255 : 32767); /* most blocks a lane can count before it overflows (16 bit lanes get summed as signed) */
+					const __m128i wanted = SimdBroadcast(character), zero = _mm_setzero_si128();
+					__m128i laneCounts = zero;
+					int blockCount = 0;
+
+					auto flush = [&]()
+					{
+						if constexpr (sizeof(CharT) == 1)
+							laneCounts = _mm_sad_epu8(laneCounts, zero); /* 2 64 bit sums */
+						else if constexpr (sizeof(CharT) == 2)
+							laneCounts = _mm_madd_epi16(laneCounts, _mm_set1_epi16(1)); /* 4 32 bit sums */
+
+						alignas(16) uint32_t sums[4];
+						_mm_store_si128((__m128i*)sums, laneCounts);
+						count += (size_t)sums[0] + sums[1] + sums[2] + sums[3];
+						laneCounts = zero;
+						blockCount = 0;
+					};
+
+					for (; last - current >= laneCount; current += laneCount)
+					{
+						__m128i matchLanes = SimdEqual<CharT>(_mm_loadu_si128((const __m128i*)current), wanted);
+						if constexpr (sizeof(CharT) == 1)
+							laneCounts = _mm_sub_epi8(laneCounts, matchLanes);
+						else if constexpr (sizeof(CharT) == 2)
+							laneCounts = _mm_sub_epi16(laneCounts, matchLanes);
+						else
+							laneCounts = _mm_sub_epi32(laneCounts, matchLanes);
+
+						if (++blockCount == flushInterval)
+							flush();
+					}
+					flush();
+				}
+			#endif
+
+				for (; current != last; current++)
+				{
+					count += (*current == character);
+				}
+				return count;
+			}
+
+			/// <summary>
+			/// Finds the first character which is either of 2 characters (a letter in both cases). checks 16 bytes at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <param name="character">- first character to look for</param>
+			/// <param name="otherCharacter">- second character to look for</param>
+			/// <returns>pointer to the character or nullptr if neither is there</returns>
+			template <typename CharT>
+			constexpr const CharT* FindEitherCharacter(const CharT* first, const CharT* last, const CharT& character, const CharT& otherCharacter)
+			{
+				const CharT* current = first;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					constexpr ptrdiff_t laneCount = 16 / sizeof(CharT);
+					const __m128i wanted = SimdBroadcast(character), otherWanted = SimdBroadcast(otherCharacter);
+					for (; last - current >= laneCount; current += laneCount)
+					{
+						__m128i block = _mm_loadu_si128((const __m128i*)current);
+						unsigned matchMask = (unsigned)_mm_movemask_epi8(_mm_or_si128(SimdEqual<CharT>(block, wanted), SimdEqual<CharT>(block, otherWanted)));
+						if (matchMask != 0)
+							return current + std::countr_zero(matchMask) / sizeof(CharT);
+					}
+				}
+			#endif
+
+				for (; current != last; current++)
+				{
+					if (*current == character || *current == otherCharacter)
+						return current;
+				}
+				return nullptr;
+			}
+
+			/// <summary>
+			/// Counts how many characters from the start are whitespace (or aren't, to skip over a word). checks 16 bytes at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <param name="whitespace">- true to count whitespace, false to count everything else</param>
+			/// <returns>length of the run at the start</returns>
+			template <typename CharT>
+			constexpr size_t CountWhitespaceRun(const CharT* first, const CharT* last, const bool& whitespace)
+			{
+				const CharT* current = first;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					constexpr ptrdiff_t laneCount = 16 / sizeof(CharT);
+					const __m128i space = SimdBroadcast((CharT)' '), belowTab = SimdBroadcast((CharT)('\t' - 1)), aboveReturn = SimdBroadcast((CharT)('\r' + 1));
+					const unsigned flipMask = (whitespace ? 0xFFFF : 0); /* turns the whitespace mask into a mask of where the run ends */
+					for (; last - current >= laneCount; current += laneCount)
+					{
+						__m128i block = _mm_loadu_si128((const __m128i*)current);
+						__m128i whitespaceLanes = _mm_or_si128(SimdEqual<CharT>(block, space), _mm_and_si128(SimdGreater<CharT>(block, belowTab), SimdGreater<CharT>(aboveReturn, block)));
+						unsigned endMask = (unsigned)_mm_movemask_epi8(whitespaceLanes) ^ flipMask;
+						if (endMask != 0)
+							return (current - first) + std::countr_zero(endMask) / sizeof(CharT);
+					}
+				}
+			#endif
+
+				while (current != last && IsAsciiWhitespace(*current) == whitespace)
+				{
+					current++;
+				}
+				return current - first;
+			}
+
+			/// <summary>
+			/// Lower or upper cases the ASCII letters in place, everything else stays the same. converts 16 bytes at a time with SSE2
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <param name="upperCase">- true to upper case, false to lower case</param>
+			template <typename CharT>
+			constexpr void ConvertAsciiCase(CharT* first, CharT* last, const bool& upperCase)
+			{
+				CharT* current = first;
+
+			#if defined(NOSSTDLIB_SSE2)
+				if (!std::is_constant_evaluated()) /* the intrinsics can't run at compile time */
+				{
+					constexpr ptrdiff_t laneCount = 16 / sizeof(CharT);
+					const CharT rangeStart = (upperCase ? (CharT)'a' : (CharT)'A');
+					const __m128i belowRange = SimdBroadcast((CharT)(rangeStart - 1)), aboveRange = SimdBroadcast((CharT)(rangeStart + 26)), caseBit = SimdBroadcast((CharT)0x20);
+					for (; last - current >= laneCount; current += laneCount)
+					{
+						__m128i block = _mm_loadu_si128((const __m128i*)current);
+						__m128i letterLanes = _mm_and_si128(SimdGreater<CharT>(block, belowRange), SimdGreater<CharT>(aboveRange, block));
+						_mm_storeu_si128((__m128i*)current, _mm_xor_si128(block, _mm_and_si128(letterLanes, caseBit))); /* the letter cases only differ by 0x20 */
+					}
+				}
+			#endif
+
+				for (; current != last; current++)
+				{
+					*current = (upperCase ? ToUpperAscii(*current) : ToLowerAscii(*current));
+				}
+			}
+
+			/// <summary>
+			/// inclusive range of code points
+			/// </summary>
+			struct CodePointRange
+			{
+				char32_t First, Last;
+			};
+
+			/// <summary>
+			/// code points which take up no cells: common combining blocks and format characters, not every single zero width code point
+			/// </summary>
+			inline constexpr CodePointRange ZeroWidthRanges[] =
+			{
+				{0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x05BF, 0x05BF}, {0x05C1, 0x05C2}, {0x05C4, 0x05C5}, {0x05C7, 0x05C7},
+				{0x0610, 0x061A}, {0x064B, 0x065F}, {0x0670, 0x0670}, {0x06D6, 0x06DC}, {0x06DF, 0x06E4}, {0x06E7, 0x06E8}, {0x06EA, 0x06ED},
+				{0x0900, 0x0902}, {0x093A, 0x093A}, {0x093C, 0x093C}, {0x0941, 0x0948}, {0x094D, 0x094D}, {0x0951, 0x0957}, {0x0962, 0x0963},
+				{0x0E31, 0x0E31}, {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x1160, 0x11FF}, {0x1AB0, 0x1AFF}, {0x1DC0, 0x1DFF},
+				{0x200B, 0x200F}, {0x202A, 0x202E}, {0x2060, 0x2064}, {0x20D0, 0x20FF}, {0x302A, 0x302D}, {0x3099, 0x309A},
+				{0xFE00, 0xFE0F}, {0xFE20, 0xFE2F}, {0xFEFF, 0xFEFF}, {0xE0001, 0xE0001}, {0xE0020, 0xE007F}, {0xE0100, 0xE01EF},
+			};
+
+			/// <summary>
+			/// code points which take up 2 cells: East Asian Wide and Fullwidth, including the emoji which terminals draw 2 cells wide
+			/// </summary>
+			inline constexpr CodePointRange WideRanges[] =
+			{
+				{0x1100, 0x115F}, {0x231A, 0x231B}, {0x2329, 0x232A}, {0x23E9, 0x23EC}, {0x23F0, 0x23F0}, {0x23F3, 0x23F3}, {0x25FD, 0x25FE},
+				{0x2614, 0x2615}, {0x2648, 0x2653}, {0x267F, 0x267F}, {0x2693, 0x2693}, {0x26A1, 0x26A1}, {0x26AA, 0x26AB}, {0x26BD, 0x26BE},
+				{0x26C4, 0x26C5}, {0x26CE, 0x26CE}, {0x26D4, 0x26D4}, {0x26EA, 0x26EA}, {0x26F2, 0x26F3}, {0x26F5, 0x26F5}, {0x26FA, 0x26FA},
+				{0x26FD, 0x26FD}, {0x2705, 0x2705}, {0x270A, 0x270B}, {0x2728, 0x2728}, {0x274C, 0x274C}, {0x274E, 0x274E}, {0x2753, 0x2755},
+				{0x2757, 0x2757}, {0x2795, 0x2797}, {0x27B0, 0x27B0}, {0x27BF, 0x27BF}, {0x2B1B, 0x2B1C}, {0x2B50, 0x2B50}, {0x2B55, 0x2B55},
+				{0x2E80, 0x303E}, {0x3041, 0x33FF}, {0x3400, 0x4DBF}, {0x4E00, 0x9FFF}, {0xA000, 0xA4CF}, {0xA960, 0xA97F}, {0xAC00, 0xD7A3},
+				{0xF900, 0xFAFF}, {0xFE10, 0xFE19}, {0xFE30, 0xFE6F}, {0xFF00, 0xFF60}, {0xFFE0, 0xFFE6},
+				{0x16FE0, 0x16FE4}, {0x17000, 0x18AFF}, {0x1B000, 0x1B2FF}, {0x1F004, 0x1F004}, {0x1F0CF, 0x1F0CF}, {0x1F18E, 0x1F18E},
+				{0x1F191, 0x1F19A}, {0x1F200, 0x1F202}, {0x1F210, 0x1F23B}, {0x1F240, 0x1F248}, {0x1F250, 0x1F251}, {0x1F260, 0x1F265},
+				{0x1F300, 0x1F320}, {0x1F32D, 0x1F335}, {0x1F337, 0x1F37C}, {0x1F37E, 0x1F393}, {0x1F3A0, 0x1F3CA}, {0x1F3CF, 0x1F3D3},
+				{0x1F3E0, 0x1F3F0}, {0x1F3F4, 0x1F3F4}, {0x1F3F8, 0x1F43E}, {0x1F440, 0x1F440}, {0x1F442, 0x1F4FC}, {0x1F4FF, 0x1F53D},
+				{0x1F54B, 0x1F54E}, {0x1F550, 0x1F567}, {0x1F57A, 0x1F57A}, {0x1F595, 0x1F596}, {0x1F5A4, 0x1F5A4}, {0x1F5FB, 0x1F64F},
+				{0x1F680, 0x1F6C5}, {0x1F6CC, 0x1F6CC}, {0x1F6D0, 0x1F6D2}, {0x1F6D5, 0x1F6D7}, {0x1F6DC, 0x1F6DF}, {0x1F6EB, 0x1F6EC},
+				{0x1F6F4, 0x1F6FC}, {0x1F7E0, 0x1F7EB}, {0x1F7F0, 0x1F7F0}, {0x1F90C, 0x1F93A}, {0x1F93C, 0x1F945}, {0x1F947, 0x1F9FF},
+				{0x1FA70, 0x1FAFF}, {0x20000, 0x2FFFD}, {0x30000, 0x3FFFD},
+			};
+		}
+	#pragma endregion
+
+
 	#pragma region String Conversion
+		/// <summary>
+		/// what the conversion functions do when they find an invalid sequence (lone surrogate, bad UTF-8 byte, overlong encoding...)
+		/// </summary>
+		enum class ConversionErrorPolicy : uint8_t
+		{
+			Replace = 0,	/* invalid sequences become U+FFFD */
+			Throw = 1,		/* invalid sequences throw std::range_error */
+			Stop = 2,		/* conversion stops at the first invalid sequence and returns what was converted before it */
+		};
+
+		/// <summary>
+		/// code point which invalid sequences get replaced with
+		/// </summary>
+		inline constexpr char32_t ReplacementCharacter = 0xFFFD;
+
+		/// <summary>
+		/// Gets the exact length a string will have after conversion. the encoding comes from the code unit size (1 = UTF-8, 2 = UTF-16, 4 = UTF-32)
+		/// </summary>
+		/// <typeparam name="StringTo">- the string output type</typeparam>
+		/// <typeparam name="StringFrom">- the string input type</typeparam>
+		/// <param name="first">- pointer to the first code unit</param>
+		/// <param name="last">- pointer past the last code unit</param>
+		/// <param name="errorPolicy">(default = Replace) - what to do with invalid sequences</param>
+		/// <returns>amount of StringTo code units</returns>
+		template <typename StringTo, typename StringFrom>
+		size_t GetConvertedLength(const StringFrom* first, const StringFrom* last, const ConversionErrorPolicy& errorPolicy = ConversionErrorPolicy::Replace)
+		{
+			if constexpr (sizeof(StringFrom) == sizeof(StringTo)) /* same encoding, gets copied as is */
+			{
+				return last - first;
+			}
+			else
+			{
+				size_t length = 0;
+				const StringFrom* current = first;
+				while (current != last)
+				{
+					if ((std::make_unsigned_t<StringFrom>)*current < 0x80) /* ASCII is 1 unit in every encoding */
+					{
+						size_t asciiRun = Kernels::CountLeadingAscii(current, last);
+						current += asciiRun;
+						length += asciiRun;
+						continue;
+					}
+
+					char32_t codePoint;
+					if (!Kernels::DecodeCodePoint(current, last, codePoint))
+					{
+						if (errorPolicy == ConversionErrorPolicy::Throw)
+						{
+							throw std::range_error("invalid unicode sequence");
+						}
+						else if (errorPolicy == ConversionErrorPolicy::Stop)
+						{
+							break;
+						}
+						codePoint = ReplacementCharacter;
+					}
+					length += Kernels::EncodedLength<StringTo>(codePoint);
+				}
+				return length;
+			}
+		}
+
 		/// <summary>
 		/// Converts any string type to any other string type. template <ToType, FromType>
+		/// the encoding comes from the code unit size: 1 byte is UTF-8, 2 bytes is UTF-16 and 4 bytes is UTF-32 (so wstring is UTF-16 on Windows).
+		/// the output length gets worked out first so the output only allocates once
 		/// </summary>
 		/// <typeparam name="StringFrom">- the string input type</typeparam>
 		/// <typeparam name="StringTo">- the string output type</typeparam>
 		/// <param name="strIn">- string input</param>
+		/// <param name="errorPolicy">(default = Replace) - what to do with invalid sequences</param>
 		/// <returns>converted string</returns>
 		template< typename StringTo, typename StringFrom>
-		std::basic_string<StringTo> ConvertStringTypes(const std::basic_string<StringFrom>& strIn)
+		std::basic_string<StringTo> ConvertStringTypes(const std::basic_string<StringFrom>& strIn, const ConversionErrorPolicy& errorPolicy = ConversionErrorPolicy::Replace)
 		{
 			if constexpr (std::is_same_v<StringFrom, StringTo>) /* if same character type, then just return string */
 			{
 				return strIn;
 			}
-			else /* else, do standard conversion*/
+			else if constexpr (sizeof(StringFrom) == sizeof(StringTo)) /* same encoding with a different type (char and char8_t), copy units */
+			{
+				return std::basic_string<StringTo>(strIn.begin(), strIn.end());
+			}
+			else
 			{
+				const StringFrom* current = strIn.data();
+				const StringFrom* last = strIn.data() + strIn.size();
+
 				std::basic_string<StringTo> strOut;
-				std::copy(strIn.begin(), strIn.end(), std::back_insert_iterator(strOut));
+				strOut.resize(GetConvertedLength<StringTo>(current, last, errorPolicy)); /* throws here for the Throw policy, before anything gets written */
+				StringTo* output = strOut.data();
+
+				while (current != last)
+				{
+					if ((std::make_unsigned_t<StringFrom>)*current < 0x80)
+					{
+						size_t asciiRun = Kernels::CountLeadingAscii(current, last);
+						Kernels::CopyAscii(current, asciiRun, output);
+						current += asciiRun;
+						output += asciiRun;
+						continue;
+					}
+
+					char32_t codePoint;
+					if (!Kernels::DecodeCodePoint(current, last, codePoint))
+					{
+						if (errorPolicy != ConversionErrorPolicy::Replace) /* only Stop can get here */
+						{
+							break;
+						}
+						codePoint = ReplacementCharacter;
+					}
+					Kernels::EncodeCodePoint(output, codePoint);
+				}
+
 				return strOut;
 			}
 		}
 
-		#define ToString ConvertStringTypes<char, wchar_t>
-		#define ToWstring ConvertStringTypes<wchar_t, char> 
+		/// <summary>
+		/// Converts a wide string (UTF-16 on Windows) to a UTF-8 string
+		/// </summary>
+		/// <param name="wstr">- string input</param>
+		/// <param name="errorPolicy">(default = Replace) - what to do with invalid sequences</param>
+		/// <returns>UTF-8 string</returns>
+		inline std::string ToString(const std::wstring& wstr, const ConversionErrorPolicy& errorPolicy = ConversionErrorPolicy::Replace)
+		{
+			return ConvertStringTypes<char, wchar_t>(wstr, errorPolicy);
+		}
+
+		/// <summary>
+		/// Converts a UTF-8 string to a wide string (UTF-16 on Windows)
+		/// </summary>
+		/// <param name="str">- string input</param>
+		/// <param name="errorPolicy">(default = Replace) - what to do with invalid sequences</param>
+		/// <returns>wide string</returns>
+		inline std::wstring ToWstring(const std::string& str, const ConversionErrorPolicy& errorPolicy = ConversionErrorPolicy::Replace)
+		{
+			return ConvertStringTypes<wchar_t, char>(str, errorPolicy);
+		}
+	#pragma endregion
+
+	#pragma region IsNumber
+		/// <summary>
+		/// Check if string is number (with or without signs)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="str">- string to check</param>
+		/// <param name="allowSigns">(default = true) - if it should allow signs at the start of the string (-123 or +123)</param>
+		/// <returns>if string is valid number</returns>
+		template <typename CharT>
+		constexpr bool IsNumber(std::basic_string_view<CharT> str, bool allowSigns = true)
+		{
+			const CharT* first = str.data();
+			const CharT* last = str.data() + str.size();
+
+			/* skip the sign if allowed, the number still needs atleast 1 digit after it */
+			if (allowSigns && first != last && (*first == (CharT)'-' || *first == (CharT)'+'))
+				first++;
+
+			return first != last && Kernels::CountLeadingDigits(first, last) == (size_t)(last - first);
+		}
+
+		/// <summary>
+		/// Check if string is number (with or without signs)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="str">- string to check</param>
+		/// <param name="allowSigns">(default = true) - if it should allow signs at the start of the string (-123 or +123)</param>
+		/// <returns>if string is valid number</returns>
+		template <typename CharT>
+		constexpr bool IsNumber(const std::basic_string<CharT>& str, bool allowSigns = true)
+		{
+			return IsNumber(std::basic_string_view<CharT>(str), allowSigns);
+		}
+
+		/// <summary>
+		/// Check if a null terminated string (literal) is number, works at compile time: static_assert(IsNumber(L"1234"))
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="str">- string to check</param>
+		/// <param name="allowSigns">(default = true) - if it should allow signs at the start of the string (-123 or +123)</param>
+		/// <returns>if string is valid number</returns>
+		template <typename CharT>
+		constexpr bool IsNumber(const CharT* str, bool allowSigns = true)
+		{
+			return IsNumber(std::basic_string_view<CharT>(str), allowSigns);
+		}
 	#pragma endregion
 
+	#pragma region Number Parsing
+		/// <summary>
+		/// result status of the Parse functions
+		/// </summary>
+		enum class ParseStatus : uint8_t
+		{
+			Ok = 0,			/* number got parsed */
+			Invalid = 1,	/* no number at the start of the input */
+			Overflow = 2,	/* number is too big for the type (value is left unchanged) */
+			Underflow = 3,	/* float is too close to 0 for the type, even as a denormal (value is left unchanged) */
+		};
+
+		/// <summary>
+		/// what the Parse functions return (like std::from_chars_result)
+		/// </summary>
+		/// <typeparam name="CharT">- character type</typeparam>
+		template <typename CharT>
+		struct ParseResult
+		{
+			const CharT* Position;	/* first character which isn't part of the number (first if Invalid) */
+			ParseStatus Status;		/* if it worked */
+
+			/// <summary>
+			/// true if the number got parsed
+			/// </summary>
+			explicit operator bool() const { return Status == ParseStatus::Ok; }
+		};
+
+		/// <summary>
+		/// Parses an integer at the start of the input in one pass. works like std::from_chars but allows a '+' sign and works for wchar_t.
+		/// doesn't throw or allocate, overflow gets reported through the status
+		/// </summary>
+		/// <typeparam name="IntegerT">- integer type to parse into</typeparam>
+		/// <typeparam name="CharT">- character type</typeparam>
+		/// <param name="first">- pointer to the first character</param>
+		/// <param name="last">- pointer past the last character</param>
+		/// <param name="value">- gets set to the number (only if the status is Ok)</param>
+		/// <param name="base">(default = 10) - base of the number (2 to 36, any other base returns Invalid)</param>
+		/// <returns>position after the number and the status</returns>
+		template <typename IntegerT, typename CharT>
+		ParseResult<CharT> ParseInteger(const CharT* first, const CharT* last, IntegerT& value, const int& base = 10)
+		{
+			static_assert(std::is_integral_v<IntegerT> && !std::is_same_v<IntegerT, bool>, "IntegerT has to be an integer type");
+			using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+			if (base < 2 || base > 36) /* digits only go up to 'z' */
+				return { first, ParseStatus::Invalid };
+
+			const CharT* current = first;
+			bool negative = false;
+			if (current != last && (*current == (CharT)'-' || *current == (CharT)'+'))
+			{
+				negative = (*current == (CharT)'-');
+				if (negative && std::is_unsigned_v<IntegerT>)
+					return { first, ParseStatus::Invalid };
+				current++;
+			}
+
+			/* biggest magnitude which fits. for signed types the negative side fits 1 more */
+			UnsignedT limit = (UnsignedT)(std::numeric_limits<IntegerT>::max)() + (negative ? 1 : 0);
+			UnsignedT magnitude = 0;
+			bool overflow = false;
+			const CharT* digitsStart = current;
+
+			if (base == 10)
+			{
+				const CharT* digitsEnd = current + Kernels::CountLeadingDigits(current, last);
+				for (; current != digitsEnd; current++)
+				{
+					UnsignedT digit = (UnsignedT)(*current - (CharT)'0');
+					if (magnitude > (limit - digit) / 10)
+						overflow = true;
+					else
+						magnitude = magnitude * 10 + digit;
+				}
+			}
+			else
+			{
+				for (; current != last; current++)
+				{
+					int digit;
+					if (*current >= (CharT)'0' && *current <= (CharT)'9')
+						digit = (int)(*current - (CharT)'0');
+					else if (*current >= (CharT)'a' && *current <= (CharT)'z')
+						digit = (int)(*current - (CharT)'a') + 10;
+					else if (*current >= (CharT)'A' && *current <= (CharT)'Z')
+						digit = (int)(*current - (CharT)'A') + 10;
+					else
+						break;
+
+					if (digit >= base)
+						break;
+
+					if (magnitude > (limit - (UnsignedT)digit) / (UnsignedT)base)
+						overflow = true;
+					else
+						magnitude = magnitude * (UnsignedT)base + (UnsignedT)digit;
+				}
+			}
+
+			if (current == digitsStart)
+				return { first, ParseStatus::Invalid };
+			if (overflow)
+				return { current, ParseStatus::Overflow };
+
+			value = (negative ? (IntegerT)(UnsignedT)(0 - magnitude) : (IntegerT)magnitude);
+			return { current, ParseStatus::Ok };
+		}
+
+		/// <summary>
+		/// Parses an integer from the whole string (the status is Invalid if anything comes after the number)
+		/// </summary>
+		/// <typeparam name="IntegerT">- integer type to parse into</typeparam>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="str">- string to parse</param>
+		/// <param name="value">- gets set to the number (only if the status is Ok)</param>
+		/// <param name="base">(default = 10) - base of the number (2 to 36, any other base returns Invalid)</param>
+		/// <returns>the status</returns>
+		template <typename IntegerT, typename CharT>
+		ParseStatus ParseInteger(const std::basic_string<CharT>& str, IntegerT& value, const int& base = 10)
+		{
+			const CharT* last = str.data() + str.size();
+			ParseResult<CharT> result = ParseInteger(str.data(), last, value, base);
+			return (result.Status == ParseStatus::Ok && result.Position != last ? ParseStatus::Invalid : result.Status);
+		}
+
+		/// <summary>
+		/// Parses a float at the start of the input (digits, optional '.', optional exponent) in one pass.
+		/// doesn't throw, overflow and underflow get reported through the status. uses std::from_chars after checking the characters, wchar_t gets narrowed first
+		/// </summary>
+		/// <typeparam name="FloatT">- float, double or long double</typeparam>
+		/// <typeparam name="CharT">- character type</typeparam>
+		/// <param name="first">- pointer to the first character</param>
+		/// <param name="last">- pointer past the last character</param>
+		/// <param name="value">- gets set to the number (only if the status is Ok)</param>
+		/// <returns>position after the number and the status</returns>
+		template <typename FloatT, typename CharT>
+		ParseResult<CharT> ParseFloat(const CharT* first, const CharT* last, FloatT& value)
+		{
+			static_assert(std::is_floating_point_v<FloatT>, "FloatT has to be a floating point type");
+
+			/* find where the number ends: [sign] digits [. digits] [e [sign] digits] */
+			const CharT* current = first;
+			if (current != last && (*current == (CharT)'-' || *current == (CharT)'+'))
+				current++;
+			const CharT* mantissaStart = current;
+			current += Kernels::CountLeadingDigits(current, last);
+			size_t mantissaDigits = current - mantissaStart;
+			if (current != last && *current == (CharT)'.')
+			{
+				current++;
+				size_t fractionDigits = Kernels::CountLeadingDigits(current, last);
+				current += fractionDigits;
+				mantissaDigits += fractionDigits;
+			}
+			if (mantissaDigits == 0)
+				return { first, ParseStatus::Invalid };
+
+			if (current != last && (*current == (CharT)'e' || *current == (CharT)'E'))
+			{
+				const CharT* exponent = current + 1;
+				if (exponent != last && (*exponent == (CharT)'-' || *exponent == (CharT)'+'))
+					exponent++;
+				size_t exponentDigits = Kernels::CountLeadingDigits(exponent, last);
+				if (exponentDigits != 0) /* "1e" is just 1 followed by an e */
+					current = exponent + exponentDigits;
+			}
+
+			/* std::from_chars doesn't take '+' and only works on char, so hand it the checked characters as char */
+			const CharT* numberStart = (*first == (CharT)'+' ? first + 1 : first);
+			size_t length = current - numberStart;
+			char stackBuffer[64];
+			std::string heapBuffer;
+			char* buffer = stackBuffer;
+			if (length > sizeof(stackBuffer))
+			{
+				heapBuffer.resize(length);
+				buffer = heapBuffer.data();
+			}
+			for (size_t i = 0; i < length; i++)
+				buffer[i] = (char)numberStart[i];
+
+			FloatT parsed;
+			std::from_chars_result result = std::from_chars(buffer, buffer + length, parsed, std::chars_format::general);
+			if (result.ec == std::errc::result_out_of_range) /* from_chars doesn't say which way, the exponent does (the limits are ~300 orders of magnitude away from 0) */
+			{
+				const char* digits = (*buffer == '-' ? buffer + 1 : buffer);
+				return { current, (Kernels::GetDecimalExponent(digits, buffer + length) < 0 ? ParseStatus::Underflow : ParseStatus::Overflow) };
+			}
+			if (result.ec != std::errc())
+				return { first, ParseStatus::Invalid };
+
+			value = parsed;
+			return { numberStart + (result.ptr - buffer), ParseStatus::Ok };
+		}
+
+		/// <summary>
+		/// Parses a float from the whole string (the status is Invalid if anything comes after the number)
+		/// </summary>
+		/// <typeparam name="FloatT">- float, double or long double</typeparam>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="str">- string to parse</param>
+		/// <param name="value">- gets set to the number (only if the status is Ok)</param>
+		/// <returns>the status</returns>
+		template <typename FloatT, typename CharT>
+		ParseStatus ParseFloat(const std::basic_string<CharT>& str, FloatT& value)
+		{
+			const CharT* last = str.data() + str.size();
+			ParseResult<CharT> result = ParseFloat(str.data(), last, value);
+			return (result.Status == ParseStatus::Ok && result.Position != last ? ParseStatus::Invalid : result.Status);
+		}
+	#pragma endregion
+
+	#pragma region Split
+		/// <summary>
+		/// Lazy split of a string into string views (no copies or allocations, the views point into the input so it has to stay alive).
+		/// works like Split/getline: every delimiter ends a token, except a delimiter at the very end doesn't make an empty last token.
+		/// everything is constexpr, so literals can be split at compile time (see CountTokens and SplitToArray)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		template <typename CharT>
+		class SplitView
+		{
+		private:
+			std::basic_string_view<CharT> Input;		/* string being split */
+			std::basic_string_view<CharT> Delimiter;	/* delimiter (can be multiple characters) */
+			CharT SingleDelimiter;						/* storage for single character delimiters so Delimiter can point to it */
+			bool SkipEmpty;								/* if empty tokens (2 delimiters in a row) should be skipped */
+
+			/// <summary>
+			/// Finds the next delimiter from a position. the first character gets found with memchr/wmemchr (vectorized by the CRT), multi character delimiters then compare the rest
+			/// </summary>
+			/// <param name="position">- position to start looking from</param>
+			/// <returns>position of the delimiter or npos</returns>
+			constexpr size_t FindDelimiter(const size_t& position) const
+			{
+				const CharT* current = Input.data() + position;
+				const CharT* last = Input.data() + Input.size();
+				const size_t delimiterLength = Delimiter.size();
+
+				while ((size_t)(last - current) >= delimiterLength)
+				{
+					const CharT* found = Kernels::FindCharacter(current, last - (delimiterLength - 1), Delimiter[0]);
+					if (found == nullptr)
+						return std::basic_string_view<CharT>::npos;
+					if (delimiterLength == 1 || std::char_traits<CharT>::compare(found + 1, Delimiter.data() + 1, delimiterLength - 1) == 0)
+						return found - Input.data();
+					current = found + 1;
+				}
+				return std::basic_string_view<CharT>::npos;
+			}
+		public:
+			/// <summary>
+			/// forward iterator which finds the next token when it gets incremented
+			/// </summary>
+			class iterator
+			{
+			private:
+				const SplitView* View;	/* the split (nullptr for the end iterator) */
+				size_t TokenStart;		/* position of the current token */
+				size_t TokenEnd;		/* position of the delimiter after the current token (or input size) */
+
+				/// <summary>
+				/// finds the end of the token which starts at TokenStart, becomes the end iterator if there are no tokens left
+				/// </summary>
+				constexpr void FindToken()
+				{
+					while (View != nullptr)
+					{
+						if (TokenStart >= View->Input.size()) /* a delimiter at the very end doesn't make another token */
+						{
+							View = nullptr;
+							return;
+						}
+
+						size_t delimiter = View->FindDelimiter(TokenStart);
+						TokenEnd = (delimiter == std::basic_string_view<CharT>::npos ? View->Input.size() : delimiter);
+						if (!View->SkipEmpty || TokenEnd != TokenStart)
+							return;
+						TokenStart = TokenEnd + View->Delimiter.size();
+					}
+				}
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = std::basic_string_view<CharT>;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const value_type*;
+				using reference = value_type;
+
+				constexpr iterator() : View(nullptr), TokenStart(0), TokenEnd(0) {}
+				constexpr iterator(const SplitView* view) : View(view), TokenStart(0), TokenEnd(0) { FindToken(); }
+
+				constexpr value_type operator*() const { return View->Input.substr(TokenStart, TokenEnd - TokenStart); }
+
+				constexpr iterator& operator++()
+				{
+					TokenStart = TokenEnd + View->Delimiter.size();
+					FindToken();
+					return *this;
+				}
+				constexpr iterator operator++(int) { iterator copy = *this; ++*this; return copy; }
+
+				constexpr bool operator==(const iterator& other) const { return View == other.View && (View == nullptr || TokenStart == other.TokenStart); }
+				constexpr bool operator!=(const iterator& other) const { return !(*this == other); }
+			};
+
+			/// <summary>
+			/// Split with a single character delimiter
+			/// </summary>
+			/// <param name="input">- string to split (has to stay alive while the view is used)</param>
+			/// <param name="delimiter">- character which splits the tokens</param>
+			/// <param name="skipEmpty">(default = false) - if empty tokens should be skipped (for example words seperated by multiple spaces)</param>
+			constexpr SplitView(std::basic_string_view<CharT> input, const CharT& delimiter, const bool& skipEmpty = false)
+				: Input(input), SingleDelimiter(delimiter), SkipEmpty(skipEmpty)
+			{
+				Delimiter = std::basic_string_view<CharT>(&SingleDelimiter, 1);
+			}
+
+			/// <summary>
+			/// Split with a multi character delimiter
+			/// </summary>
+			/// <param name="input">- string to split (has to stay alive while the view is used)</param>
+			/// <param name="delimiter">- string which splits the tokens (has to stay alive and can't be empty)</param>
+			/// <param name="skipEmpty">(default = false) - if empty tokens should be skipped</param>
+			constexpr SplitView(std::basic_string_view<CharT> input, std::basic_string_view<CharT> delimiter, const bool& skipEmpty = false)
+				: Input(input), Delimiter(delimiter), SingleDelimiter(), SkipEmpty(skipEmpty)
+			{
+				if (Delimiter.empty())
+				{
+					throw std::invalid_argument("delimiter can't be empty");
+				}
+			}
+
+			/// <summary>
+			/// splitting a temporary string would leave the views dangling, so it isn't allowed
+			/// </summary>
+			template<class StringType> requires std::is_same_v<StringType, std::basic_string<CharT>>
+			SplitView(StringType&&, const CharT&, const bool& = false) = delete;
+			template<class StringType> requires std::is_same_v<StringType, std::basic_string<CharT>>
+			SplitView(StringType&&, std::basic_string_view<CharT>, const bool& = false) = delete;
+
+			/// <summary>
+			/// copying has to point Delimiter at the copies own SingleDelimiter
+			/// </summary>
+			constexpr SplitView(const SplitView& other) : Input(other.Input), Delimiter(other.Delimiter), SingleDelimiter(other.SingleDelimiter), SkipEmpty(other.SkipEmpty)
+			{
+				if (other.Delimiter.data() == &other.SingleDelimiter)
+					Delimiter = std::basic_string_view<CharT>(&SingleDelimiter, 1);
+			}
+
+			constexpr SplitView& operator=(const SplitView& other)
+			{
+				Input = other.Input;
+				SingleDelimiter = other.SingleDelimiter;
+				SkipEmpty = other.SkipEmpty;
+				Delimiter = (other.Delimiter.data() == &other.SingleDelimiter ? std::basic_string_view<CharT>(&SingleDelimiter, 1) : other.Delimiter);
+				return *this;
+			}
+
+			constexpr iterator begin() const { return iterator(this); }
+			constexpr iterator end() const { return iterator(); }
+		};
+
+		template <typename CharT> SplitView(const std::basic_string<CharT>&, CharT, bool = false) -> SplitView<CharT>;
+		template <typename CharT> SplitView(std::basic_string_view<CharT>, CharT, bool = false) -> SplitView<CharT>;
+		template <typename CharT> SplitView(const CharT*, CharT, bool = false) -> SplitView<CharT>;
+		template <typename CharT> SplitView(const std::basic_string<CharT>&, const CharT*, bool = false) -> SplitView<CharT>;
+		template <typename CharT> SplitView(std::basic_string_view<CharT>, const CharT*, bool = false) -> SplitView<CharT>;
+		template <typename CharT> SplitView(const CharT*, const CharT*, bool = false) -> SplitView<CharT>;
+
+		/// <summary>
+		/// Counts the tokens a split would make, works at compile time so it can size SplitToArray
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <typeparam name="DelimiterType">- character or string view</typeparam>
+		/// <param name="input">- string to split</param>
+		/// <param name="delimiter">- character or string which splits the tokens</param>
+		/// <param name="skipEmpty">(default = false) - if empty tokens should be skipped</param>
+		/// <returns>amount of tokens</returns>
+		template <typename CharT, typename DelimiterType>
+		constexpr size_t CountTokens(std::basic_string_view<CharT> input, const DelimiterType& delimiter, const bool& skipEmpty = false)
+		{
+			SplitView<CharT> split(input, delimiter, skipEmpty);
+			size_t tokenCount = 0;
+			for (typename SplitView<CharT>::iterator token = split.begin(); token != split.end(); ++token)
+			{
+				tokenCount++;
+			}
+			return tokenCount;
+		}
+
+		/// <summary>
+		/// Splits a string into a fixed size array of views, nothing gets allocated so a literal can get split at compile time
+		/// <code>
+		/// constexpr std::wstring_view options = L"Start|Options|Exit";
+		/// constexpr auto optionNames = SplitToArray&lt;CountTokens(options, L'|')&gt;(options, L'|');
+		/// </code>
+		/// </summary>
+		/// <typeparam name="TokenCount">- size of the array, throws std::length_error if the split makes a different amount of tokens</typeparam>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <typeparam name="DelimiterType">- character or string view</typeparam>
+		/// <param name="input">- string to split (has to outlive the array)</param>
+		/// <param name="delimiter">- character or string which splits the tokens</param>
+		/// <param name="skipEmpty">(default = false) - if empty tokens should be skipped</param>
+		/// <returns>array of tokens</returns>
+		template <size_t TokenCount, typename CharT, typename DelimiterType>
+		constexpr std::array<std::basic_string_view<CharT>, TokenCount> SplitToArray(std::basic_string_view<CharT> input, const DelimiterType& delimiter, const bool& skipEmpty = false)
+		{
+			std::array<std::basic_string_view<CharT>, TokenCount> tokens{};
+			size_t tokenCount = 0;
+			for (std::basic_string_view<CharT> token : SplitView<CharT>(input, delimiter, skipEmpty))
+			{
+				if (tokenCount == TokenCount)
+				{
+					throw std::length_error("more tokens then the array can hold");
+				}
+				tokens[tokenCount++] = token;
+			}
+
+			if (tokenCount != TokenCount)
+			{
+				throw std::length_error("less tokens then the array holds");
+			}
+			return tokens;
+		}
+
+		/// <summary>
+		/// Split a string into a vectory array using a delimiter
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="result">- the vector that will get modified</param>
+		/// <param name="input">- the input that will get split</param>
+		/// <param name="delimiter">(default = L' ') - delimiter which will determine the split</param>
+		/// <returns>pointer to modified vector</returns>
+		template <typename CharT>
+		std::vector<std::basic_string<CharT>>* Split(std::vector<std::basic_string<CharT>>* result, std::basic_string<CharT>* input, const CharT& delimiter = L' ')
+		{
+			for (std::basic_string_view<CharT> token : SplitView<CharT>(*input, delimiter))
+			{
+				result->emplace_back(token);
+			}
+
+			return result;
+		}
+	#pragma endregion
+
+	#pragma region Display Width
+		/// <summary>
+		/// Gets how many terminal cells a code point takes up.
+		/// 0 for control characters and zero width characters (combining marks, joiners, variation selectors), 2 for East Asian wide and fullwidth characters, 1 for the rest.
+		/// box drawing and block characters count as 1 (East Asian ambiguous), which is how the Windows console draws them
+		/// </summary>
+		/// <param name="codePoint">- the code point</param>
+		/// <returns>width in cells</returns>
+		constexpr int GetCodePointWidth(const char32_t& codePoint)
+		{
+			auto inRanges = [&codePoint](const Kernels::CodePointRange* first, const Kernels::CodePointRange* last)
+			{
+				const Kernels::CodePointRange* range = std::lower_bound(first, last, codePoint, [](const Kernels::CodePointRange& range, const char32_t& value) { return range.Last < value; });
+				return (range != last && range->First <= codePoint);
+			};
+
+			if (codePoint < 0x20 || (codePoint >= 0x7F && codePoint < 0xA0)) /* C0 and C1 control characters */
+			{
+				return 0;
+			}
+			else if (codePoint < 0x300) /* nothing below the combining diacritical marks is wide or zero width */
+			{
+				return 1;
+			}
+			else if (inRanges(std::begin(Kernels::ZeroWidthRanges), std::end(Kernels::ZeroWidthRanges)))
+			{
+				return 0;
+			}
+			else if (inRanges(std::begin(Kernels::WideRanges), std::end(Kernels::WideRanges)))
+			{
+				return 2;
+			}
+			return 1;
+		}
+
+		/// <summary>
+		/// Gets how many terminal cells a string takes up when printed.
+		/// ANSI escape sequences (SGR colors from MakeANSICode, cursor movement and OSC titles) take up nothing, wide characters take up 2 and zero width characters nothing.
+		/// the encoding comes from the code unit size (1 = UTF-8, 2 = UTF-16, 4 = UTF-32), invalid sequences count as 1 cell (like the replacement character they get drawn as)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="text">- text to measure (new lines count as 0, so measure 1 line at a time)</param>
+		/// <returns>width in cells</returns>
+		template <typename CharT>
+		constexpr size_t GetDisplayWidth(std::basic_string_view<CharT> text)
+		{
+			using UnitType = std::make_unsigned_t<CharT>;
+			const CharT* current = text.data();
+			const CharT* last = text.data() + text.size();
+			size_t width = 0;
+
+			while (current != last)
+			{
+				size_t printableRun = Kernels::CountLeadingPrintableAscii(current, last); /* plain text is 1 cell per unit */
+				width += printableRun;
+				current += printableRun;
+				if (current == last)
+				{
+					break;
+				}
+
+				UnitType unit = (UnitType)*current;
+				if (unit == 0x1B) /* escape sequence */
+				{
+					current++;
+					if (current == last)
+					{
+						break;
+					}
+
+					UnitType introducer = (UnitType)*current++;
+					if (introducer == '[') /* CSI: parameter and intermediate bytes (0x20-0x3F) then 1 final byte (0x40-0x7E) */
+					{
+						while (current != last && (UnitType)*current >= 0x20 && (UnitType)*current <= 0x3F)
+						{
+							current++;
+						}
+						if (current != last && (UnitType)*current >= 0x40 && (UnitType)*current <= 0x7E)
+						{
+							current++;
+						}
+					}
+					else if (introducer == ']') /* OSC: ends with BEL or ESC \ */
+					{
+						while (current != last && (UnitType)*current != 0x07 && (UnitType)*current != 0x1B)
+						{
+							current++;
+						}
+						if (current != last)
+						{
+							current += ((UnitType)*current == 0x1B && last - current >= 2 ? 2 : 1);
+						}
+					}
+					/* any other escape is just the escape and 1 character, which already got skipped */
+				}
+				else if (unit < 0x80) /* other ASCII control characters */
+				{
+					current++;
+				}
+				else
+				{
+					char32_t codePoint;
+					width += (Kernels::DecodeCodePoint(current, last, codePoint) ? GetCodePointWidth(codePoint) : 1);
+				}
+			}
+
+			return width;
+		}
+
+		/// <summary>
+		/// Gets how many terminal cells a string takes up when printed
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="text">- text to measure</param>
+		/// <returns>width in cells</returns>
+		template <typename CharT>
+		constexpr size_t GetDisplayWidth(const std::basic_string<CharT>& text)
+		{
+			return GetDisplayWidth(std::basic_string_view<CharT>(text));
+		}
+	#pragma endregion
+
+	#pragma region Builder
+		/// <summary>
+		/// Appends centered lines, each ending with a new line, to anything with Append and AppendRepeat (Builder, FixedString).
+		/// the width gets measured in cells (GetDisplayWidth), so colors and wide characters don't throw it off
+		/// </summary>
+		/// <typeparam name="OutputType">- type being appended to</typeparam>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="output">- what to append to</param>
+		/// <param name="input">- text to center</param>
+		/// <param name="columns">- width of the console</param>
+		/// <param name="rightPadding">- if it should pad the right side with spaces too</param>
+		/// <param name="all">- if it should center just first line or all lines</param>
+		template <typename OutputType, typename CharT>
+		constexpr void AppendCenteredLines(OutputType& output, std::basic_string_view<CharT> input, const int& columns, const bool& rightPadding, const bool& all)
+		{
+			auto appendLine = [&](std::basic_string_view<CharT> line)
+			{
+				int lineSize = (int)GetDisplayWidth(line);
+				int leftPaddingSize = (columns / 2) - lineSize / 2;
+				leftPaddingSize = (leftPaddingSize > 0 ? leftPaddingSize : 0); /* lines wider then the console don't get padding */
+
+				output.AppendRepeat((CharT)' ', leftPaddingSize);
+				output.Append(line);
+				if (rightPadding)
+					output.AppendRepeat((CharT)' ', columns - (lineSize + leftPaddingSize));
+				output.Append((CharT)'\n');
+			};
+
+			if (all)
+			{
+				for (std::basic_string_view<CharT> line : SplitView<CharT>(input, (CharT)'\n')) /* views into input, no copy per line */
+				{
+					appendLine(line);
+				}
+			}
+			else
+			{
+				appendLine(input);
+			}
+		}
+
+		/// <summary>
+		/// Builds up a string (a frame, a menu entry...) in a single reusable buffer.
+		/// unlike chaining std::wstring(...) + ... + ..., appending doesn't make temporaries, and after Clear() the capacity stays so building the next frame doesn't allocate
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		template <typename CharT>
+		class Builder
+		{
+		private:
+			std::basic_string<CharT> Buffer; /* the backing buffer, only ever grows */
+		public:
+			/// <summary>
+			/// Creates the builder
+			/// </summary>
+			/// <param name="sizeHint">(default = 0) - how many characters to reserve up front</param>
+			Builder(const size_t& sizeHint = 0)
+			{
+				Buffer.reserve(sizeHint);
+			}
+
+			/// <summary>
+			/// Appends a string
+			/// </summary>
+			/// <param name="text">- text to append</param>
+			/// <returns>the builder, so appends can be chained</returns>
+			Builder& Append(std::basic_string_view<CharT> text)
+			{
+				Buffer.append(text);
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends a single character
+			/// </summary>
+			/// <param name="character">- character to append</param>
+			/// <returns>the builder, so appends can be chained</returns>
+			Builder& Append(const CharT& character)
+			{
+				Buffer.push_back(character);
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends a character multiple times (padding)
+			/// </summary>
+			/// <param name="character">- character to append</param>
+			/// <param name="count">- how many times, 0 or less appends nothing</param>
+			/// <returns>the builder, so appends can be chained</returns>
+			Builder& AppendRepeat(const CharT& character, const int& count)
+			{
+				if (count > 0)
+				{
+					Buffer.append((size_t)count, character);
+				}
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends formatted text (std::format syntax) straight into the buffer, without making a temporary string
+			/// </summary>
+			/// <typeparam name="...FormatArgs">- types of the values</typeparam>
+			/// <param name="format">- format string, throws std::format_error if it is invalid</param>
+			/// <param name="...args">- values to format</param>
+			/// <returns>the builder, so appends can be chained</returns>
+			template <typename ... FormatArgs>
+			Builder& AppendFormat(std::basic_string_view<CharT> format, const FormatArgs& ... args)
+			{
+				if constexpr (std::is_same_v<CharT, wchar_t>)
+					std::vformat_to(std::back_inserter(Buffer), format, std::make_wformat_args(args...));
+				else
+					std::vformat_to(std::back_inserter(Buffer), format, std::make_format_args(args...));
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends centered lines, each ending with a new line. the width gets measured in cells (GetDisplayWidth), so colors and wide characters don't throw it off
+			/// </summary>
+			/// <param name="input">- text to center</param>
+			/// <param name="columns">- width of the console</param>
+			/// <param name="rightPadding">(default = false) - if it should pad the right side with spaces too</param>
+			/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+			/// <returns>the builder, so appends can be chained</returns>
+			Builder& AppendCentered(std::basic_string_view<CharT> input, const int& columns, const bool& rightPadding = false, const bool& all = true)
+			{
+				AppendCenteredLines(*this, input, columns, rightPadding, all);
+				return *this;
+			}
+
+			/// <summary>
+			/// Empties the builder but keeps the capacity
+			/// </summary>
+			void Clear()
+			{
+				Buffer.clear();
+			}
+
+			/// <summary>
+			/// Makes sure atleast this many characters fit without reallocating
+			/// </summary>
+			/// <param name="sizeHint">- amount of characters</param>
+			void Reserve(const size_t& sizeHint)
+			{
+				Buffer.reserve(sizeHint);
+			}
+
+			/// <summary>
+			/// Gets the amount of characters built so far
+			/// </summary>
+			/// <returns>amount of characters</returns>
+			size_t GetSize() const
+			{
+				return Buffer.size();
+			}
+
+			/// <summary>
+			/// Gets how many characters fit before the buffer has to grow
+			/// </summary>
+			/// <returns>capacity of the buffer</returns>
+			size_t GetCapacity() const
+			{
+				return Buffer.capacity();
+			}
+
+			/// <summary>
+			/// Gets a view of what was built (invalidated by the next append)
+			/// </summary>
+			/// <returns>view of the built string</returns>
+			std::basic_string_view<CharT> GetView() const
+			{
+				return Buffer;
+			}
+
+			/// <summary>
+			/// Gets the built string
+			/// </summary>
+			/// <returns>reference to the backing buffer</returns>
+			const std::basic_string<CharT>& GetString() const
+			{
+				return Buffer;
+			}
+
+			/// <summary>
+			/// Gets the built string as a null terminated string (for wprintf)
+			/// </summary>
+			/// <returns>pointer to the built string</returns>
+			const CharT* GetCString() const
+			{
+				return Buffer.c_str();
+			}
+
+			/// <summary>
+			/// Moves the built string out, the builder is empty (and has no capacity) afterwards
+			/// </summary>
+			/// <returns>the built string</returns>
+			std::basic_string<CharT> Release()
+			{
+				std::basic_string<CharT> output = std::move(Buffer);
+				Buffer.clear();
+				return output;
+			}
+		};
+	#pragma endregion
+
+	#pragma region Fixed String
+		/// <summary>
+		/// String with a fixed capacity stored inline (no heap), everything is constexpr so static layouts (titles, separators, splash screens) can get built at compile time and baked into the binary.
+		/// appending past the capacity throws std::length_error, which is a compile error when it happens at compile time
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <typeparam name="Capacity">- maximum amount of characters (not counting the null terminator)</typeparam>
+		template <typename CharT, size_t Capacity>
+		class FixedString
+		{
+		private:
+			CharT Buffer[Capacity + 1];	/* the characters and a null terminator */
+			size_t Size;				/* amount of characters used */
+
+			/// <summary>
+			/// throws if count more characters don't fit
+			/// </summary>
+			/// <param name="count">- amount of characters which are about to get appended</param>
+			constexpr void CheckCapacity(const size_t& count) const
+			{
+				if (count > Capacity - Size)
+				{
+					throw std::length_error("fixed string capacity exceeded");
+				}
+			}
+		public:
+			/// <summary>
+			/// Creates an empty string
+			/// </summary>
+			constexpr FixedString() : Buffer(), Size(0) {}
+
+			/// <summary>
+			/// Creates the string from text
+			/// </summary>
+			/// <param name="text">- text to copy in, throws std::length_error if it doesn't fit</param>
+			constexpr FixedString(std::basic_string_view<CharT> text) : Buffer(), Size(0)
+			{
+				Append(text);
+			}
+
+			/// <summary>
+			/// Creates the string from a null terminated string (literal)
+			/// </summary>
+			/// <param name="text">- text to copy in, throws std::length_error if it doesn't fit</param>
+			constexpr FixedString(const CharT* text) : FixedString(std::basic_string_view<CharT>(text)) {}
+
+			/// <summary>
+			/// Appends a string
+			/// </summary>
+			/// <param name="text">- text to append</param>
+			/// <returns>the string, so appends can be chained</returns>
+			constexpr FixedString& Append(std::basic_string_view<CharT> text)
+			{
+				CheckCapacity(text.size());
+				std::char_traits<CharT>::copy(Buffer + Size, text.data(), text.size());
+				Size += text.size();
+				Buffer[Size] = (CharT)'\0';
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends a single character
+			/// </summary>
+			/// <param name="character">- character to append</param>
+			/// <returns>the string, so appends can be chained</returns>
+			constexpr FixedString& Append(const CharT& character)
+			{
+				CheckCapacity(1);
+				Buffer[Size++] = character;
+				Buffer[Size] = (CharT)'\0';
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends a character multiple times (padding)
+			/// </summary>
+			/// <param name="character">- character to append</param>
+			/// <param name="count">- how many times, 0 or less appends nothing</param>
+			/// <returns>the string, so appends can be chained</returns>
+			constexpr FixedString& AppendRepeat(const CharT& character, const int& count)
+			{
+				if (count > 0)
+				{
+					CheckCapacity((size_t)count);
+					std::char_traits<CharT>::assign(Buffer + Size, (size_t)count, character);
+					Size += (size_t)count;
+					Buffer[Size] = (CharT)'\0';
+				}
+				return *this;
+			}
+
+			/// <summary>
+			/// Appends centered lines, each ending with a new line (GetCenteredLength gives the capacity needed)
+			/// </summary>
+			/// <param name="input">- text to center</param>
+			/// <param name="columns">- width of the console</param>
+			/// <param name="rightPadding">(default = false) - if it should pad the right side with spaces too</param>
+			/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+			/// <returns>the string, so appends can be chained</returns>
+			constexpr FixedString& AppendCentered(std::basic_string_view<CharT> input, const int& columns, const bool& rightPadding = false, const bool& all = true)
+			{
+				AppendCenteredLines(*this, input, columns, rightPadding, all);
+				return *this;
+			}
+
+			/// <summary>
+			/// Empties the string
+			/// </summary>
+			constexpr void Clear()
+			{
+				Size = 0;
+				Buffer[0] = (CharT)'\0';
+			}
+
+			/// <summary>
+			/// Gets the amount of characters
+			/// </summary>
+			/// <returns>amount of characters</returns>
+			constexpr size_t GetSize() const
+			{
+				return Size;
+			}
+
+			/// <summary>
+			/// Gets the maximum amount of characters
+			/// </summary>
+			/// <returns>the capacity</returns>
+			static constexpr size_t GetCapacity()
+			{
+				return Capacity;
+			}
+
+			/// <summary>
+			/// Gets a view of the string
+			/// </summary>
+			/// <returns>view of the string</returns>
+			constexpr std::basic_string_view<CharT> GetView() const
+			{
+				return std::basic_string_view<CharT>(Buffer, Size);
+			}
+
+			/// <summary>
+			/// Gets the string as a null terminated string (for wprintf)
+			/// </summary>
+			/// <returns>pointer to the string</returns>
+			constexpr const CharT* GetCString() const
+			{
+				return Buffer;
+			}
+		};
+
+		template <typename CharT, size_t ArraySize> FixedString(const CharT(&)[ArraySize]) -> FixedString<CharT, ArraySize - 1>;
+	#pragma endregion
+
+	#pragma region CenterString
+		/// <summary>
+		/// Center string with a known console width (doesn't have to ask the console, so it is cheap enough to call every frame)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to center</param>
+		/// <param name="columns">- width of the console (ConsoleSizeStruct.Columns)</param>
+		/// <param name="rightPadding">(default = false) - if it should pad the right side with spaces too</param>
+		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+		/// <returns>centered string</returns>
+		template <typename CharT>
+		std::basic_string<CharT> CenterString(std::basic_string_view<CharT> input, const int& columns, bool rightPadding = false, bool all = true)
+		{
+			Builder<CharT> output(input.size() + (columns > 0 ? columns : 0) + 1); /* atleast 1 padded line, more lines grow it */
+			output.AppendCentered(input, columns, rightPadding, all);
+			return output.Release();
+		}
+
+		/// <summary>
+		/// Center string with a known console width
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to center</param>
+		/// <param name="columns">- width of the console (ConsoleSizeStruct.Columns)</param>
+		/// <param name="rightPadding">(default = false) - if it should pad the right side with spaces too</param>
+		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+		/// <returns>centered string</returns>
+		template <typename CharT>
+		std::basic_string<CharT> CenterString(const std::basic_string<CharT>& input, const int& columns, bool rightPadding = false, bool all = true)
+		{
+			return CenterString<CharT>(std::basic_string_view<CharT>(input), columns, rightPadding, all);
+		}
+
+		/// <summary>
+		/// Gets how many characters centering a string would make, works at compile time so it can size CenterFixed
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to center</param>
+		/// <param name="columns">- width of the console</param>
+		/// <param name="rightPadding">(default = false) - if it should pad the right side with spaces too</param>
+		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+		/// <returns>length of the centered string</returns>
+		template <typename CharT>
+		constexpr size_t GetCenteredLength(std::basic_string_view<CharT> input, const int& columns, const bool& rightPadding = false, const bool& all = true)
+		{
+			struct LengthCounter
+			{
+				size_t Length; /* characters appended so far */
+
+				constexpr void Append(std::basic_string_view<CharT> text) { Length += text.size(); }
+				constexpr void Append(const CharT&) { Length++; }
+				constexpr void AppendRepeat(const CharT&, const int& count) { Length += (count > 0 ? (size_t)count : 0); }
+			};
+
+			LengthCounter counter{0};
+			AppendCenteredLines(counter, input, columns, rightPadding, all);
+			return counter.Length;
+		}
+
+		/// <summary>
+		/// Center string into a FixedString, for layouts which are known at compile time (the console width has to be known too, so use a fixed layout width)
+		/// <code>
+		/// constexpr std::wstring_view title = L"Main Menu";
+		/// constexpr auto centeredTitle = CenterFixed&lt;GetCenteredLength(title, 80)&gt;(title, 80);
+		/// </code>
+		/// </summary>
+		/// <typeparam name="Capacity">- capacity of the result, throws std::length_error if the centered string doesn't fit</typeparam>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to center</param>
+		/// <param name="columns">- width of the layout</param>
+		/// <param name="rightPadding">(default = false) - if it should pad the right side with spaces too</param>
+		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+		/// <returns>centered string</returns>
+		template <size_t Capacity, typename CharT>
+		constexpr FixedString<CharT, Capacity> CenterFixed(std::basic_string_view<CharT> input, const int& columns, const bool& rightPadding = false, const bool& all = true)
+		{
+			FixedString<CharT, Capacity> output;
+			output.AppendCentered(input, columns, rightPadding, all);
+			return output;
+		}
+
+		/// <summary>
+		/// Center string with custom console Handle
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="consoleHandle">- Custom Console Handle</param>
+		/// <param name="input">- wstring to center</param>
+		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+		/// <returns>centered string</returns>
+		template <typename CharT>
+		std::basic_string<CharT> CenterString(HANDLE consoleHandle, std::basic_string<CharT> input, bool rightPadding = false, bool all = true)
+		{
+			CONSOLE_SCREEN_BUFFER_INFO csbi;
+			GetConsoleScreenBufferInfo(consoleHandle, &csbi);
+			return CenterString<CharT>(std::basic_string_view<CharT>(input), csbi.srWindow.Right - csbi.srWindow.Left + 1, rightPadding, all);
+		}
+
+		/// <summary>
+		/// Center wstring 
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- wstring to center</param>
+		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
+		/// <returns>centered wstring</returns>
+		template <typename CharT>
+		std::basic_string<CharT> CenterString(std::basic_string<CharT> input, bool rightPadding = false, bool all = true)
+		{
+			return CenterString<CharT>(GetStdHandle(STD_OUTPUT_HANDLE), input, rightPadding, all);
+		}
+	#pragma endregion
+
+	#pragma region Word Index
+		/// <summary>
+		/// position of a word inside the string it was found in
+		/// </summary>
+		struct WordSpan
+		{
+			size_t Offset;	/* position of the first character */
+			size_t Length;	/* amount of characters */
+		};
+
+		/// <summary>
+		/// Streaming tokenizer which hands out 1 word at a time from a buffer without copying anything.
+		/// words are runs of characters which aren't delimiters, so repeated delimiters never make empty words.
+		/// the tokenizer only keeps a view, the buffer has to stay alive while it is used
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		template <typename CharT>
+		class WordTokenizer
+		{
+		private:
+			std::basic_string_view<CharT> Input;		/* the buffer */
+			std::basic_string_view<CharT> Delimiters;	/* every character which splits words */
+			CharT SingleDelimiter;						/* storage for the single character constructor */
+			size_t Position;							/* where the next word gets looked for */
+
+			/// <summary>
+			/// checks if a character is one of the delimiters
+			/// </summary>
+			/// <param name="character">- character to check</param>
+			/// <returns>if it is a delimiter</returns>
+			bool IsDelimiter(const CharT& character) const
+			{
+				return (Delimiters.size() == 1 ? character == Delimiters[0] : Delimiters.find(character) != std::basic_string_view<CharT>::npos);
+			}
+		public:
+			/// <summary>
+			/// Tokenizer with a single delimiter
+			/// </summary>
+			/// <param name="input">- buffer to tokenize</param>
+			/// <param name="delimiter">(default = ' ') - character which splits words</param>
+			/// <param name="startPosition">(default = 0) - position to start from</param>
+			WordTokenizer(std::basic_string_view<CharT> input, const CharT& delimiter = (CharT)' ', const size_t& startPosition = 0)
+			{
+				Input = input;
+				SingleDelimiter = delimiter;
+				Delimiters = std::basic_string_view<CharT>(&SingleDelimiter, 1);
+				SetPosition(startPosition);
+			}
+
+			/// <summary>
+			/// Tokenizer with a set of delimiters (for example " \t")
+			/// </summary>
+			/// <param name="input">- buffer to tokenize</param>
+			/// <param name="delimiters">- every character which splits words, has to stay alive while the tokenizer is used</param>
+			/// <param name="startPosition">(default = 0) - position to start from</param>
+			WordTokenizer(std::basic_string_view<CharT> input, std::basic_string_view<CharT> delimiters, const size_t& startPosition = 0)
+			{
+				if (delimiters.empty())
+				{
+					throw std::invalid_argument("delimiters can't be empty");
+				}
+
+				Input = input;
+				SingleDelimiter = delimiters[0];
+				Delimiters = (delimiters.size() == 1 ? std::basic_string_view<CharT>(&SingleDelimiter, 1) : delimiters);
+				SetPosition(startPosition);
+			}
+
+			/// <summary>
+			/// tokenizing a temporary string would leave the views dangling, so it isn't allowed
+			/// </summary>
+			template<class StringType> requires std::is_same_v<StringType, std::basic_string<CharT>>
+			WordTokenizer(StringType&&, const CharT& = (CharT)' ', const size_t& = 0) = delete;
+			template<class StringType> requires std::is_same_v<StringType, std::basic_string<CharT>>
+			WordTokenizer(StringType&&, std::basic_string_view<CharT>, const size_t& = 0) = delete;
+
+			/// <summary>
+			/// copying has to point Delimiters at the copies own SingleDelimiter
+			/// </summary>
+			WordTokenizer(const WordTokenizer& other) : Input(other.Input), Delimiters(other.Delimiters), SingleDelimiter(other.SingleDelimiter), Position(other.Position)
+			{
+				if (other.Delimiters.data() == &other.SingleDelimiter)
+					Delimiters = std::basic_string_view<CharT>(&SingleDelimiter, 1);
+			}
+
+			WordTokenizer& operator=(const WordTokenizer& other)
+			{
+				Input = other.Input;
+				SingleDelimiter = other.SingleDelimiter;
+				Delimiters = (other.Delimiters.data() == &other.SingleDelimiter ? std::basic_string_view<CharT>(&SingleDelimiter, 1) : other.Delimiters);
+				Position = other.Position;
+				return *this;
+			}
+
+			/// <summary>
+			/// Gets the next word
+			/// </summary>
+			/// <param name="word">- gets set to the position of the word</param>
+			/// <returns>false if there are no words left</returns>
+			bool Next(WordSpan& word)
+			{
+				const CharT* first = Input.data();
+				const CharT* last = Input.data() + Input.size();
+				const CharT* current = first + Position;
+
+				while (current != last && IsDelimiter(*current)) /* skip the delimiters before the word */
+				{
+					current++;
+				}
+
+				if (current == last)
+				{
+					Position = Input.size();
+					return false;
+				}
+
+				const CharT* wordEnd;
+				if (Delimiters.size() == 1)
+				{
+					wordEnd = Kernels::FindCharacter(current + 1, last, Delimiters[0]);
+					wordEnd = (wordEnd == nullptr ? last : wordEnd);
+				}
+				else
+				{
+					wordEnd = current + 1;
+					while (wordEnd != last && !IsDelimiter(*wordEnd))
+					{
+						wordEnd++;
+					}
+				}
+
+				word = { (size_t)(current - first), (size_t)(wordEnd - current) };
+				Position = wordEnd - first;
+				return true;
+			}
+
+			/// <summary>
+			/// Gets the next word
+			/// </summary>
+			/// <param name="word">- gets set to a view of the word</param>
+			/// <returns>false if there are no words left</returns>
+			bool Next(std::basic_string_view<CharT>& word)
+			{
+				WordSpan span;
+				if (!Next(span))
+				{
+					return false;
+				}
+				word = Input.substr(span.Offset, span.Length);
+				return true;
+			}
+
+			/// <summary>
+			/// Gets the position the next word gets looked for from
+			/// </summary>
+			/// <returns>position in the buffer</returns>
+			size_t GetPosition() const
+			{
+				return Position;
+			}
+
+			/// <summary>
+			/// Moves the tokenizer (positions past the end get clamped to the end)
+			/// </summary>
+			/// <param name="position">- position to look for the next word from</param>
+			void SetPosition(const size_t& position)
+			{
+				Position = (position < Input.size() ? position : Input.size());
+			}
+		};
+
+		template <typename CharT> WordTokenizer(const std::basic_string<CharT>&, CharT, size_t = 0) -> WordTokenizer<CharT>;
+		template <typename CharT> WordTokenizer(std::basic_string_view<CharT>, CharT, size_t = 0) -> WordTokenizer<CharT>;
+		template <typename CharT> WordTokenizer(const std::basic_string<CharT>&, const CharT*, size_t = 0) -> WordTokenizer<CharT>;
+		template <typename CharT> WordTokenizer(std::basic_string_view<CharT>, const CharT*, size_t = 0) -> WordTokenizer<CharT>;
+
+		/// <summary>
+		/// Index of every word in a string, built in 1 pass so getting the nth word afterwards is O(1) (instead of rescanning like FindNthWord).
+		/// the index only keeps a view, the string has to stay alive while it is used
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		template <typename CharT>
+		class WordIndex
+		{
+		private:
+			std::basic_string_view<CharT> Input;	/* the indexed string */
+			std::vector<WordSpan> Words;			/* position of every word in order */
+
+			/// <summary>
+			/// goes over the input once and records every word
+			/// </summary>
+			/// <param name="tokenizer">- tokenizer over Input</param>
+			void Build(WordTokenizer<CharT> tokenizer)
+			{
+				WordSpan span;
+				while (tokenizer.Next(span))
+				{
+					Words.push_back(span);
+				}
+			}
+		public:
+			/// <summary>
+			/// Indexes a string with a single delimiter
+			/// </summary>
+			/// <param name="input">- string to index</param>
+			/// <param name="delimiter">(default = ' ') - character which splits words</param>
+			WordIndex(std::basic_string_view<CharT> input, const CharT& delimiter = (CharT)' ')
+			{
+				Input = input;
+				Build(WordTokenizer<CharT>(input, delimiter));
+			}
+
+			/// <summary>
+			/// Indexes a string with a set of delimiters (for example " \t")
+			/// </summary>
+			/// <param name="input">- string to index</param>
+			/// <param name="delimiters">- every character which splits words</param>
+			WordIndex(std::basic_string_view<CharT> input, std::basic_string_view<CharT> delimiters)
+			{
+				Input = input;
+				Build(WordTokenizer<CharT>(input, delimiters));
+			}
+
+			/// <summary>
+			/// indexing a temporary string would leave the views dangling, so it isn't allowed
+			/// </summary>
+			template<class StringType> requires std::is_same_v<StringType, std::basic_string<CharT>>
+			WordIndex(StringType&&, const CharT& = (CharT)' ') = delete;
+			template<class StringType> requires std::is_same_v<StringType, std::basic_string<CharT>>
+			WordIndex(StringType&&, std::basic_string_view<CharT>) = delete;
+
+			/// <summary>
+			/// Gets the amount of words
+			/// </summary>
+			/// <returns>amount of words</returns>
+			size_t GetWordCount() const
+			{
+				return Words.size();
+			}
+
+			/// <summary>
+			/// Gets the position of a word
+			/// </summary>
+			/// <param name="index">- which word (0 is the first)</param>
+			/// <returns>position of the word</returns>
+			const WordSpan& GetSpan(const size_t& index) const
+			{
+				if (index >= Words.size())
+				{
+					throw std::out_of_range("position was out of range");
+				}
+				return Words[index];
+			}
+
+			/// <summary>
+			/// Gets a word
+			/// </summary>
+			/// <param name="index">- which word (0 is the first)</param>
+			/// <returns>view of the word</returns>
+			std::basic_string_view<CharT> GetWord(const size_t& index) const
+			{
+				const WordSpan& span = GetSpan(index);
+				return Input.substr(span.Offset, span.Length);
+			}
+
+			std::basic_string_view<CharT> operator[](const size_t& index) const
+			{
+				return GetWord(index);
+			}
+
+			/// <summary>
+			/// Finds which word matches
+			/// </summary>
+			/// <param name="word">- word to look for</param>
+			/// <param name="startIndex">(default = 0) - word to start looking from</param>
+			/// <returns>index of the word, npos if it isn't there</returns>
+			size_t Find(std::basic_string_view<CharT> word, const size_t& startIndex = 0) const
+			{
+				for (size_t i = startIndex; i < Words.size(); i++)
+				{
+					if (Words[i].Length == word.size() && Input.substr(Words[i].Offset, Words[i].Length) == word)
+					{
+						return i;
+					}
+				}
+				return std::basic_string_view<CharT>::npos;
+			}
+
+			/// <summary>
+			/// Gets every word position
+			/// </summary>
+			/// <returns>the word positions in order</returns>
+			const std::vector<WordSpan>& GetSpans() const
+			{
+				return Words;
+			}
+		};
+
+		template <typename CharT> WordIndex(const std::basic_string<CharT>&, CharT) -> WordIndex<CharT>;
+		template <typename CharT> WordIndex(const std::basic_string<CharT>&) -> WordIndex<CharT>;
+		template <typename CharT> WordIndex(std::basic_string_view<CharT>, CharT) -> WordIndex<CharT>;
+		template <typename CharT> WordIndex(const std::basic_string<CharT>&, const CharT*) -> WordIndex<CharT>;
+		template <typename CharT> WordIndex(std::basic_string_view<CharT>, const CharT*) -> WordIndex<CharT>;
+	#pragma endregion
+
+	#pragma region FindNextWord
+		/// <summary>
+		/// finds next word from position
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="string">- the string to look through</param>
+		/// <param name="startPosition">- position to start looking from</param>
+		/// <param name="word">- pointer to string which will get modified to the word found</param>
+		/// <param name="wordStartPosition">- pointer to int which will get modified with start position of the word</param>
+		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
+		/// <returns>the word</returns>
+		template <typename CharT>
+		std::basic_string<CharT> FindNextWord(const std::basic_string<CharT>& string, const int& startPosition, std::basic_string<CharT>* word, int* wordStartPosition, const CharT& delimiter = L' ')
+		{
+			WordTokenizer<CharT> tokenizer(string, delimiter, (startPosition > 0 ? (size_t)startPosition : 0));
+			WordSpan span;
+			if (tokenizer.Next(span)) /* word is left alone if there isn't one */
+			{
+				*word = string.substr(span.Offset, span.Length);
+				*wordStartPosition = (int)span.Offset;
+			}
+
+			return *word;
+		}
+
+
+		/// <summary>
+		/// finds next word from position without pointer returns
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="string">- the string to look through</param>
+		/// <param name="startPosition">- position to start looking from</param>
+		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
+		/// <returns>the word</returns>
+		template <typename CharT>
+		std::basic_string<CharT> FindNextWord(const std::basic_string<CharT>& string, const int& startPosition, const CharT& delimiter = L' ')
+		{
+			std::basic_string<CharT> tmpString;
+			int tmpInt;
+			return FindNextWord<CharT>(string, startPosition, &tmpString, &tmpInt, delimiter);
+		}
+	#pragma endregion
+
+	#pragma region FindNthWord
+		/// <summary>
+		/// finds Nth word from position
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="string">- the string to look through</param>
+		/// <param name="startPosition">- position to start looking from</param>
+		/// <param name="wordCount">- how many words to go over</param>
+		/// <param name="word">- pointer to string which will get modified to the word found</param>
+		/// <param name="wordStartPosition">- pointer to int which will get modified with start position of the word</param>
+		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
+		/// <returns>the word</returns>
+		template <typename CharT>
+		std::basic_string<CharT> FindNthWord(const std::basic_string<CharT>& string, const int& startPosition, const int& wordCount, std::basic_string<CharT>* word, int* wordStartPosition, const CharT& delimiter = L' ')
+		{
+			/* 1 pass, if there are less words then wordCount the last one found is kept */
+			WordTokenizer<CharT> tokenizer(string, delimiter, (startPosition > 0 ? (size_t)startPosition : 0));
+			WordSpan span, foundSpan;
+			bool found = false;
+			for (int i = 0; i <= wordCount && tokenizer.Next(span); i++)
+			{
+				foundSpan = span;
+				found = true;
+			}
+
+			if (found)
+			{
+				*word = string.substr(foundSpan.Offset, foundSpan.Length);
+				*wordStartPosition = (int)foundSpan.Offset;
+			}
+			return *word;
+		}
+
+		/// <summary>
+		/// finds Nth word from position without pointer returns
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="string">- the string to look through</param>
+		/// <param name="startPosition">- position to start looking from</param>
+		/// <param name="wordCount">- how many words to go over</param>
+		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
+		/// <returns>the word</returns>
+		template <typename CharT>
+		std::basic_string<CharT> FindNthWord(const std::basic_string<CharT>& string, const int& startPosition, const int& wordCount, const CharT& delimiter = L' ')
+		{
+			std::basic_string<CharT> tmpString;
+			int tmpInt;
+			FindNthWord<CharT>(string, startPosition, wordCount, &tmpString, &tmpInt, delimiter);
+			return tmpString;
+		}
+	#pragma endregion
+
+	#pragma region Trim
+		/// <summary>
+		/// Removes the ASCII whitespace (space, \t, \n, \v, \f, \r) from the start
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to trim</param>
+		/// <returns>view into input without the leading whitespace</returns>
+		template <typename CharT>
+		constexpr std::basic_string_view<CharT> TrimLeft(std::basic_string_view<CharT> input)
+		{
+			input.remove_prefix(Kernels::CountWhitespaceRun(input.data(), input.data() + input.size(), true));
+			return input;
+		}
+
+		/// <summary>
+		/// Removes the ASCII whitespace from the end (trailing runs are short, so this one doesn't get vectorized)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to trim</param>
+		/// <returns>view into input without the trailing whitespace</returns>
+		template <typename CharT>
+		constexpr std::basic_string_view<CharT> TrimRight(std::basic_string_view<CharT> input)
+		{
+			while (!input.empty() && Kernels::IsAsciiWhitespace(input.back()))
+			{
+				input.remove_suffix(1);
+			}
+			return input;
+		}
+
+		/// <summary>
+		/// Removes the ASCII whitespace from both ends
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to trim</param>
+		/// <returns>view into input without the leading and trailing whitespace</returns>
+		template <typename CharT>
+		constexpr std::basic_string_view<CharT> Trim(std::basic_string_view<CharT> input)
+		{
+			return TrimRight(TrimLeft(input));
+		}
+
+		/// <summary>
+		/// Removes the ASCII whitespace from the start
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to trim</param>
+		/// <returns>trimmed copy</returns>
+		template <typename CharT>
+		std::basic_string<CharT> TrimLeft(const std::basic_string<CharT>& input)
+		{
+			return std::basic_string<CharT>(TrimLeft(std::basic_string_view<CharT>(input)));
+		}
+
+		/// <summary>
+		/// Removes the ASCII whitespace from the end
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to trim</param>
+		/// <returns>trimmed copy</returns>
+		template <typename CharT>
+		std::basic_string<CharT> TrimRight(const std::basic_string<CharT>& input)
+		{
+			return std::basic_string<CharT>(TrimRight(std::basic_string_view<CharT>(input)));
+		}
+
+		/// <summary>
+		/// Removes the ASCII whitespace from both ends
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to trim</param>
+		/// <returns>trimmed copy</returns>
+		template <typename CharT>
+		std::basic_string<CharT> Trim(const std::basic_string<CharT>& input)
+		{
+			return std::basic_string<CharT>(Trim(std::basic_string_view<CharT>(input)));
+		}
 
-	#pragma region IsNumber
 		/// <summary>
-		/// Check if string is number (with or without signs)
+		/// Trims the string and collapses every whitespace run inside of it into a single fill character ("  a \t b  " becomes "a b")
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="str">- string to check</param>
-		/// <param name="allowSigns">(default = true) - if it should allow signs at the start of the string (-123 or +123)</param>
-		/// <returns>if string is valid number</returns>
+		/// <param name="input">- string to reduce</param>
+		/// <param name="fill">(default = ' ') - character which replaces each whitespace run</param>
+		/// <returns>reduced string</returns>
 		template <typename CharT>
-		bool IsNumber(const std::basic_string<CharT>& str, bool allowSigns = true)
+		std::basic_string<CharT> Reduce(std::basic_string_view<CharT> input, const CharT& fill = (CharT)' ')
 		{
-			/* Iterator int, allows for changing start position */
-			int Iteration = 0;
-			if (allowSigns)
-			{
-				/* if allowSigns is true, check if first character is either - or + or a number */
-				if ((str[0] != NosStdLib::String::ConvertStringTypes<CharT, wchar_t>(L'-') && str[0] != NosStdLib::String::ConvertStringTypes<CharT, wchar_t>(L'+')) && !std::isdigit(str[0]))
-					return false;
-
-				Iteration = 1; /* Make Iterator go up 1 so for loop doesn't check first character */
-			}
+			input = Trim(input);
+			const CharT* current = input.data();
+			const CharT* last = input.data() + input.size();
 
-			/* Simple for loop, checking if any char isn't a digit */
-			for (; Iteration < str.size(); Iteration++)
+			std::basic_string<CharT> output;
+			output.reserve(input.size());
+			while (current != last) /* after the trim it always starts with a word and ends with a word */
 			{
-				if (!std::isdigit(str[Iteration])) return false;
+				size_t wordLength = Kernels::CountWhitespaceRun(current, last, false);
+				output.append(current, wordLength);
+				current += wordLength;
+
+				if (current != last)
+				{
+					output.push_back(fill);
+					current += Kernels::CountWhitespaceRun(current, last, true);
+				}
 			}
+			return output;
+		}
 
-			return true;
+		/// <summary>
+		/// Trims the string and collapses every whitespace run inside of it into a single fill character
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to reduce</param>
+		/// <param name="fill">(default = ' ') - character which replaces each whitespace run</param>
+		/// <returns>reduced string</returns>
+		template <typename CharT>
+		std::basic_string<CharT> Reduce(const std::basic_string<CharT>& input, const CharT& fill = (CharT)' ')
+		{
+			return Reduce(std::basic_string_view<CharT>(input), fill);
 		}
 	#pragma endregion
 
-	#pragma region Split
+	#pragma region Case Conversion
 		/// <summary>
-		/// Split a string into a vectory array using a delimiter
+		/// Lower cases the ASCII letters ('A' to 'Z'), everything else (including non ASCII letters) stays the same
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="result">- the vector that will get modified</param>
-		/// <param name="input">- the input that will get split</param>
-		/// <param name="delimiter">(default = L' ') - delimiter which will determine the split</param>
-		/// <returns>pointer to modified vector</returns>
+		/// <param name="input">- string to lower case</param>
+		/// <returns>lower cased copy</returns>
 		template <typename CharT>
-		std::vector<std::basic_string<CharT>>* Split(std::vector<std::basic_string<CharT>>* result, std::basic_string<CharT>* input, const CharT& delimiter = L' ')
+		std::basic_string<CharT> ToLower(std::basic_string_view<CharT> input)
 		{
-			std::basic_string<CharT> tmp;
-			std::basic_stringstream<CharT> ss(*input);
+			std::basic_string<CharT> output(input);
+			Kernels::ConvertAsciiCase(output.data(), output.data() + output.size(), false);
+			return output;
+		}
 
-			while (std::getline(ss, tmp, delimiter))
-			{
-				result->push_back(tmp);
-			}
+		/// <summary>
+		/// Lower cases the ASCII letters ('A' to 'Z'), everything else stays the same
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to lower case</param>
+		/// <returns>lower cased copy</returns>
+		template <typename CharT>
+		std::basic_string<CharT> ToLower(const std::basic_string<CharT>& input)
+		{
+			return ToLower(std::basic_string_view<CharT>(input));
+		}
 
-			return result;
+		/// <summary>
+		/// Upper cases the ASCII letters ('a' to 'z'), everything else (including non ASCII letters) stays the same
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to upper case</param>
+		/// <returns>upper cased copy</returns>
+		template <typename CharT>
+		std::basic_string<CharT> ToUpper(std::basic_string_view<CharT> input)
+		{
+			std::basic_string<CharT> output(input);
+			Kernels::ConvertAsciiCase(output.data(), output.data() + output.size(), true);
+			return output;
+		}
+
+		/// <summary>
+		/// Upper cases the ASCII letters ('a' to 'z'), everything else stays the same
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to upper case</param>
+		/// <returns>upper cased copy</returns>
+		template <typename CharT>
+		std::basic_string<CharT> ToUpper(const std::basic_string<CharT>& input)
+		{
+			return ToUpper(std::basic_string_view<CharT>(input));
 		}
 	#pragma endregion
 
-	#pragma region CenterString
+	#pragma region Searching
 		/// <summary>
-		/// Center string with custom console Handle
+		/// Finds a string ignoring ASCII case. the first character gets looked for in both cases with SSE2, the rest gets compared after
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="consoleHandle">- Custom Console Handle</param>
-		/// <param name="input">- wstring to center</param>
-		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
-		/// <returns>centered string</returns>
+		/// <param name="input">- string to look through</param>
+		/// <param name="search">- string to look for</param>
+		/// <param name="position">(default = 0) - position to start looking from</param>
+		/// <returns>position of the match or npos</returns>
 		template <typename CharT>
-		std::basic_string<CharT> CenterString(HANDLE consoleHandle, std::basic_string<CharT> input, bool rightPadding = false, bool all = true)
+		constexpr size_t FindIgnoreCase(std::basic_string_view<CharT> input, std::type_identity_t<std::basic_string_view<CharT>> search, const size_t& position = 0)
 		{
-			CONSOLE_SCREEN_BUFFER_INFO csbi; /* TODO: change from using consoleHandle or add overload to use ConsoleSizeStruct */
-			GetConsoleScreenBufferInfo(consoleHandle, &csbi);
-			int columns = csbi.srWindow.Right - csbi.srWindow.Left + 1;
-			if (all)
+			if (position > input.size() || search.size() > input.size() - position)
+			{
+				return std::basic_string_view<CharT>::npos;
+			}
+			else if (search.empty())
 			{
-				std::vector<std::basic_string<CharT>> inputSplit;
-				std::basic_string<CharT> output;
-				NosStdLib::String::Split<CharT>(&inputSplit, &input, L'\n');
+				return position;
+			}
+
+			const CharT* current = input.data() + position;
+			const CharT* lastStart = input.data() + input.size() - search.size() + 1; /* past the last position a match could start at */
+			const CharT firstLower = Kernels::ToLowerAscii(search[0]), firstUpper = Kernels::ToUpperAscii(search[0]);
 
-				for (std::basic_string<CharT> Singleinput : inputSplit)
+			while (current != lastStart)
+			{
+				const CharT* found = Kernels::FindEitherCharacter(current, lastStart, firstLower, firstUpper);
+				if (found == nullptr)
 				{
-					output += (std::basic_string<CharT>(((columns / 2) - Singleinput.size() / 2), ' ') + Singleinput + (rightPadding ? std::wstring(max((columns - (Singleinput.size() + ((columns / 2) - Singleinput.size() / 2))), 0), L' ') : L"") + (CharT)(L'\n'));
+					return std::basic_string_view<CharT>::npos;
 				}
 
-				return output;
-			}
-			else
-			{
-				return (std::basic_string<CharT>(((columns / 2) - input.size() / 2), ' ') + input + (rightPadding ? std::wstring(max((columns - (input.size() + ((columns / 2) - input.size() / 2))), 0), L' ') : L"") + (CharT)(L'\n'));
+				size_t i = 1;
+				while (i < search.size() && Kernels::ToLowerAscii(found[i]) == Kernels::ToLowerAscii(search[i]))
+				{
+					i++;
+				}
+				if (i == search.size())
+				{
+					return found - input.data();
+				}
+				current = found + 1;
 			}
+			return std::basic_string_view<CharT>::npos;
 		}
 
 		/// <summary>
-		/// Center wstring 
+		/// Finds a string ignoring ASCII case
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="input">- wstring to center</param>
-		/// <param name="all">(default = true) - if it should center just first line or all lines</param>
-		/// <returns>centered wstring</returns>
+		/// <param name="input">- string to look through</param>
+		/// <param name="search">- string to look for</param>
+		/// <param name="position">(default = 0) - position to start looking from</param>
+		/// <returns>position of the match or npos</returns>
 		template <typename CharT>
-		std::basic_string<CharT> CenterString(std::basic_string<CharT> input, bool rightPadding = false, bool all = true)
+		constexpr size_t FindIgnoreCase(const std::basic_string<CharT>& input, std::type_identity_t<std::basic_string_view<CharT>> search, const size_t& position = 0)
 		{
-			return CenterString<CharT>(GetStdHandle(STD_OUTPUT_HANDLE), input, rightPadding, all);
+			return FindIgnoreCase(std::basic_string_view<CharT>(input), search, position);
 		}
-	#pragma endregion
 
-	#pragma region FindNextWord
 		/// <summary>
-		/// finds next word from position
+		/// Counts how many times a character shows up (SSE2 compare and popcount, e.g. counting the lines of a frame)
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="string">- the string to look through</param>
-		/// <param name="startPosition">- position to start looking from</param>
-		/// <param name="word">- pointer to string which will get modified to the word found</param>
-		/// <param name="wordStartPosition">- pointer to int which will get modified with start position of the word</param>
-		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
-		/// <returns>the word</returns>
+		/// <param name="input">- string to look through</param>
+		/// <param name="character">- character to count</param>
+		/// <returns>amount of times it shows up</returns>
 		template <typename CharT>
-		std::basic_string<CharT> FindNextWord(const std::basic_string<CharT>& string, const int& startPosition, std::basic_string<CharT>* word, int* wordStartPosition, const CharT& delimiter = L' ')
+		constexpr size_t CountChar(std::basic_string_view<CharT> input, const CharT& character)
+		{
+			return Kernels::CountCharacter(input.data(), input.data() + input.size(), character);
+		}
+
+		/// <summary>
+		/// Counts how many times a character shows up
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="input">- string to look through</param>
+		/// <param name="character">- character to count</param>
+		/// <returns>amount of times it shows up</returns>
+		template <typename CharT>
+		constexpr size_t CountChar(const std::basic_string<CharT>& input, const CharT& character)
+		{
+			return CountChar(std::basic_string_view<CharT>(input), character);
+		}
+	#pragma endregion
+
+	#pragma region Bool Parsing
+		/// <summary>
+		/// the standard token pairs which a BoolTokenSet can get made from, combine them with |
+		/// </summary>
+		enum BoolTokens : uint8_t
+		{
+			TrueFalse = 1 << 0,	/* "true" and "false" */
+			YesNo = 1 << 1,		/* "yes" and "no" */
+			OnOff = 1 << 2,		/* "on" and "off" */
+			OneZero = 1 << 3,	/* "1" and "0" */
+			AllBoolTokens = TrueFalse | YesNo | OnOff | OneZero,
+		};
+
+		/// <summary>
+		/// Set of tokens which ParseBool accepts (case insensitive). every token gets packed into a single 64 bit integer (1 byte per character),
+		/// so matching is an integer compare per token instead of a string compare
+		/// </summary>
+		class BoolTokenSet
 		{
-			uint16_t wordRange = 0, wordStartPos = 0;
-			bool wordCounting = false;
-			for (int i = startPosition; i < string.length(); i++)
+		public:
+			static constexpr size_t MaxTokens = 16;			/* most tokens a set can hold */
+			static constexpr size_t MaxTokenLength = 8;		/* longest token, 8 characters fill the 64 bit key */
+		private:
+			/// <summary>
+			/// a token packed into an integer
+			/// </summary>
+			struct Token
+			{
+				uint64_t Key;	/* the lower cased characters, first character in the lowest byte */
+				uint64_t Mask;	/* covers the bytes of the token, so the key can be compared against longer input */
+				size_t Length;	/* amount of characters */
+				bool Value;		/* what the token means */
+			};
+
+			Token Tokens[MaxTokens];	/* the tokens */
+			size_t TokenCount;			/* amount of tokens used */
+
+			/// <summary>
+			/// lower cases an ASCII code unit without a branch
+			/// </summary>
+			/// <param name="unit">- printable ASCII code unit</param>
+			/// <returns>the lower cased unit</returns>
+			static constexpr uint64_t LowerUnit(const uint32_t& unit)
+			{
+				return unit | ((uint32_t)(unit - 'A' < 26u) << 5);
+			}
+		public:
+			/// <summary>
+			/// Creates an empty set (add tokens with Add)
+			/// </summary>
+			constexpr BoolTokenSet() : Tokens{}, TokenCount(0) {}
+
+			/// <summary>
+			/// Creates a set from the standard token pairs
+			/// </summary>
+			/// <param name="standardTokens">- BoolTokens flags (e.g. TrueFalse | OnOff)</param>
+			constexpr BoolTokenSet(const uint8_t& standardTokens) : Tokens{}, TokenCount(0)
+			{
+				if (standardTokens & TrueFalse)
+					Add("true", true).Add("false", false);
+				if (standardTokens & YesNo)
+					Add("yes", true).Add("no", false);
+				if (standardTokens & OnOff)
+					Add("on", true).Add("off", false);
+				if (standardTokens & OneZero)
+					Add("1", true).Add("0", false);
+			}
+
+			/// <summary>
+			/// Adds a custom token (e.g. "enabled")
+			/// </summary>
+			/// <param name="token">- the token, 1 to 8 printable ASCII characters without spaces (throws std::invalid_argument otherwise)</param>
+			/// <param name="value">- what the token means</param>
+			/// <returns>the set, so adds can be chained</returns>
+			constexpr BoolTokenSet& Add(std::string_view token, const bool& value)
 			{
-				if (string[i] != delimiter && !wordCounting)
+				if (token.empty() || token.size() > MaxTokenLength)
+				{
+					throw std::invalid_argument("bool token has to be 1 to 8 characters");
+				}
+				if (TokenCount == MaxTokens)
 				{
-					wordCounting = true;
-					wordStartPos = i;
-					*wordStartPosition = i;
-					wordRange++;
+					throw std::length_error("bool token set is full");
 				}
 
-				if (wordCounting && string[i] != delimiter)
+				uint64_t key = 0;
+				for (size_t i = 0; i < token.size(); i++)
 				{
-					wordRange++;
+					uint32_t unit = (unsigned char)token[i];
+					if (unit <= 0x20 || unit >= 0x7F)
+					{
+						throw std::invalid_argument("bool token has to be printable ASCII without spaces");
+					}
+					key |= LowerUnit(unit) << (8 * i);
 				}
 
-				if (wordCounting && string[i] == delimiter)
+				Tokens[TokenCount++] = { key, (token.size() == 8 ? ~(uint64_t)0 : ((uint64_t)1 << (8 * token.size())) - 1), token.size(), value };
+				return *this;
+			}
+
+			/// <summary>
+			/// Matches the longest token at the start of the input
+			/// </summary>
+			/// <typeparam name="CharT">- character type</typeparam>
+			/// <param name="first">- pointer to the first character</param>
+			/// <param name="last">- pointer past the last character</param>
+			/// <param name="value">- gets set to the value of the token (only if the status is Ok)</param>
+			/// <returns>position after the token and the status</returns>
+			template <typename CharT>
+			constexpr ParseResult<CharT> Match(const CharT* first, const CharT* last, bool& value) const
+			{
+				using UnitType = std::make_unsigned_t<CharT>;
+
+				/* pack the first (up to 8) printable characters into the key, the same way the tokens got packed */
+				size_t available = ((size_t)(last - first) < MaxTokenLength ? (size_t)(last - first) : MaxTokenLength);
+				uint64_t key = 0;
+				size_t packedLength = 0;
+				for (; packedLength < available; packedLength++)
 				{
-					break;
+					uint32_t unit = (uint32_t)(UnitType)first[packedLength];
+					if (unit <= 0x20 || unit >= 0x7F)
+						break;
+					key |= LowerUnit(unit) << (8 * packedLength);
 				}
+
+				size_t matchLength = 0;
+				bool matchValue = false;
+				for (size_t i = 0; i < TokenCount; i++)
+				{
+					const Token& token = Tokens[i];
+					bool hit = (token.Length <= packedLength) & ((key & token.Mask) == token.Key) & (token.Length > matchLength);
+					matchLength = (hit ? token.Length : matchLength);
+					matchValue = (hit ? token.Value : matchValue);
+				}
+
+				if (matchLength == 0)
+				{
+					return { first, ParseStatus::Invalid };
+				}
+				value = matchValue;
+				return { first + matchLength, ParseStatus::Ok };
 			}
 
-			if (wordRange != 0)
+			/// <summary>
+			/// Gets the amount of tokens in the set
+			/// </summary>
+			/// <returns>amount of tokens</returns>
+			constexpr size_t GetTokenCount() const
 			{
-				*word = string.substr(wordStartPos, wordRange);
+				return TokenCount;
 			}
+		};
 
-			return *word;
+		/// <summary>
+		/// tokens ParseBool uses by default: true/false, yes/no, on/off and 1/0
+		/// </summary>
+		inline constexpr BoolTokenSet DefaultBoolTokens = BoolTokenSet(AllBoolTokens);
+
+		/// <summary>
+		/// Parses a bool token at the start of the input (case insensitive). doesn't throw or allocate
+		/// </summary>
+		/// <typeparam name="CharT">- character type</typeparam>
+		/// <param name="first">- pointer to the first character</param>
+		/// <param name="last">- pointer past the last character</param>
+		/// <param name="value">- gets set to the value (only if the status is Ok)</param>
+		/// <param name="tokens">(default = DefaultBoolTokens) - which tokens are accepted</param>
+		/// <returns>position after the token and the status</returns>
+		template <typename CharT>
+		constexpr ParseResult<CharT> ParseBool(const CharT* first, const CharT* last, bool& value, const BoolTokenSet& tokens = DefaultBoolTokens)
+		{
+			return tokens.Match(first, last, value);
 		}
 
+		/// <summary>
+		/// Parses a bool from the whole string (the status is Invalid if anything comes after the token)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		/// <param name="str">- string to parse</param>
+		/// <param name="value">- gets set to the value (only if the status is Ok)</param>
+		/// <param name="tokens">(default = DefaultBoolTokens) - which tokens are accepted</param>
+		/// <returns>the status</returns>
+		template <typename CharT>
+		constexpr ParseStatus ParseBool(std::basic_string_view<CharT> str, bool& value, const BoolTokenSet& tokens = DefaultBoolTokens)
+		{
+			const CharT* last = str.data() + str.size();
+			bool parsed = false;
+			ParseResult<CharT> result = tokens.Match(str.data(), last, parsed);
+			if (result.Status != ParseStatus::Ok || result.Position != last)
+			{
+				return ParseStatus::Invalid;
+			}
+			value = parsed;
+			return ParseStatus::Ok;
+		}
 
 		/// <summary>
-		/// finds next word from position without pointer returns
+		/// Parses a bool from the whole string (the status is Invalid if anything comes after the token)
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="string">- the string to look through</param>
-		/// <param name="startPosition">- position to start looking from</param>
-		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
-		/// <returns>the word</returns>
+		/// <param name="str">- string to parse</param>
+		/// <param name="value">- gets set to the value (only if the status is Ok)</param>
+		/// <param name="tokens">(default = DefaultBoolTokens) - which tokens are accepted</param>
+		/// <returns>the status</returns>
 		template <typename CharT>
-		std::basic_string<CharT> FindNextWord(const std::basic_string<CharT>& string, const int& startPosition, const CharT& delimiter = L' ')
+		constexpr ParseStatus ParseBool(const std::basic_string<CharT>& str, bool& value, const BoolTokenSet& tokens = DefaultBoolTokens)
 		{
-			std::basic_string<CharT> tmpString;
-			int tmpInt;
-			return FindNextWord<CharT>(string, startPosition, &tmpString, &tmpInt, delimiter);
+			return ParseBool(std::basic_string_view<CharT>(str), value, tokens);
 		}
-	#pragma endregion
 
-	#pragma region FindNthWord
 		/// <summary>
-		/// finds Nth word from position
+		/// Parses a whole column of bools at once (e.g. every line of a config column) in a single pass over the characters, whitespace around each field gets skipped. no allocations
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="string">- the string to look through</param>
-		/// <param name="startPosition">- position to start looking from</param>
-		/// <param name="wordCount">- how many words to go over</param>
-		/// <param name="word">- pointer to string which will get modified to the word found</param>
-		/// <param name="wordStartPosition">- pointer to int which will get modified with start position of the word</param>
-		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
-		/// <returns>the word</returns>
+		/// <param name="column">- the fields</param>
+		/// <param name="values">- where the values go (std::vector&lt;bool&gt; can't be used, it is bit packed)</param>
+		/// <param name="delimiter">(default = '\n') - character between the fields</param>
+		/// <param name="tokens">(default = DefaultBoolTokens) - which tokens are accepted</param>
+		/// <returns>amount of values parsed. stops at the first invalid field (so the return value is its index) or when values is full</returns>
 		template <typename CharT>
-		std::basic_string<CharT> FindNthWord(const std::basic_string<CharT>& string, const int& startPosition, const int& wordCount, std::basic_string<CharT>* word, int* wordStartPosition, const CharT& delimiter = L' ')
+		size_t ParseBoolColumn(std::basic_string_view<CharT> column, std::span<bool> values, const CharT& delimiter = (CharT)'\n', const BoolTokenSet& tokens = DefaultBoolTokens)
 		{
-			FindNextWord<CharT>(string, startPosition, word, wordStartPosition, delimiter);
-			for (int i = 0; i < wordCount; i++)
+			const CharT* current = column.data();
+			const CharT* last = column.data() + column.size();
+			auto skipWhitespace = [&]()
+			{
+				while (current != last && *current != delimiter && Kernels::IsAsciiWhitespace(*current))
+					current++;
+			};
+
+			/* fields are short, so matching straight from the column beats finding the delimiter first and then trimming */
+			size_t count = 0;
+			while (current != last && count < values.size())
 			{
-				FindNextWord<CharT>(string, ((*wordStartPosition) + word->length()), word, wordStartPosition, delimiter);
+				skipWhitespace();
+				bool parsed = false;
+				ParseResult<CharT> result = tokens.Match(current, last, parsed);
+				if (result.Status != ParseStatus::Ok)
+				{
+					break;
+				}
+				current = result.Position;
+				skipWhitespace();
+				if (current != last && *current != delimiter) /* something else after the token */
+				{
+					break;
+				}
+
+				values[count++] = parsed;
+				if (current != last)
+				{
+					current++; /* the delimiter */
+				}
 			}
-			return *word;
+			return count;
 		}
 
 		/// <summary>
-		/// finds Nth word from position without pointer returns
+		/// Parses a whole column of bools at once
 		/// </summary>
 		/// <typeparam name="CharT">- string type</typeparam>
-		/// <param name="string">- the string to look through</param>
-		/// <param name="startPosition">- position to start looking from</param>
-		/// <param name="wordCount">- how many words to go over</param>
-		/// <param name="delimiters">(default = L' ') - what character to ignore</param>
-		/// <returns>the word</returns>
+		/// <param name="column">- the fields</param>
+		/// <param name="values">- where the values go</param>
+		/// <param name="delimiter">(default = '\n') - character between the fields</param>
+		/// <param name="tokens">(default = DefaultBoolTokens) - which tokens are accepted</param>
+		/// <returns>amount of values parsed. stops at the first invalid field (so the return value is its index) or when values is full</returns>
 		template <typename CharT>
-		std::basic_string<CharT> FindNthWord(const std::basic_string<CharT>& string, const int& startPosition, const int& wordCount, const CharT& delimiter = L' ')
+		size_t ParseBoolColumn(const std::basic_string<CharT>& column, std::span<bool> values, const CharT& delimiter = (CharT)'\n', const BoolTokenSet& tokens = DefaultBoolTokens)
 		{
-			std::basic_string<CharT> tmpString;
-			int tmpInt;
-			FindNthWord<CharT>(string, startPosition, wordCount, &tmpString, &tmpInt, delimiter);
-			return tmpString;
+			return ParseBoolColumn(std::basic_string_view<CharT>(column), values, delimiter, tokens);
 		}
 	#pragma endregion
+
+	#pragma region Interning
+		template <typename CharT>
+		class Interner;
+
+		/// <summary>
+		/// Handle to a string stored once in an Interner. it is a single pointer, so copying, comparing (==) and hashing are O(1) no matter how long the string is.
+		/// only compare handles from the same interner, the same text in 2 interners gives 2 different handles
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		template <typename CharT>
+		class InternedString
+		{
+		private:
+			friend class Interner<CharT>;
+
+			/// <summary>
+			/// header in front of the characters inside the interner's arena
+			/// </summary>
+			struct Entry
+			{
+				size_t Hash;	/* std::hash of the text, worked out once when it gets interned */
+				size_t Size;	/* amount of characters (the null terminator comes after them) */
+			};
+
+			const Entry* Data; /* the interned string (nullptr for the empty string) */
+
+			InternedString(const Entry* data) : Data(data) {}
+
+			/// <summary>
+			/// Gets the characters which come after an entry
+			/// </summary>
+			/// <param name="entry">- the entry</param>
+			/// <returns>pointer to the first character</returns>
+			static const CharT* GetCharacters(const Entry* entry)
+			{
+				return (const CharT*)(entry + 1);
+			}
+		public:
+			/// <summary>
+			/// Creates a handle to the empty string
+			/// </summary>
+			InternedString() : Data(nullptr) {}
+
+			/// <summary>
+			/// Gets a view of the string (stays valid as long as the interner is alive)
+			/// </summary>
+			/// <returns>view of the string</returns>
+			std::basic_string_view<CharT> GetView() const
+			{
+				return (Data == nullptr ? std::basic_string_view<CharT>() : std::basic_string_view<CharT>(GetCharacters(Data), Data->Size));
+			}
+
+			/// <summary>
+			/// Gets the string as a null terminated string (for wprintf)
+			/// </summary>
+			/// <returns>pointer to the string</returns>
+			const CharT* GetCString() const
+			{
+				static const CharT emptyString[1] = {};
+				return (Data == nullptr ? emptyString : GetCharacters(Data));
+			}
+
+			/// <summary>
+			/// Gets the amount of characters
+			/// </summary>
+			/// <returns>amount of characters</returns>
+			size_t GetSize() const
+			{
+				return (Data == nullptr ? 0 : Data->Size);
+			}
+
+			/// <summary>
+			/// Gets the hash of the string without going over the characters, it is the same as std::hash of the text
+			/// </summary>
+			/// <returns>hash of the string</returns>
+			size_t GetHash() const
+			{
+				return (Data == nullptr ? std::hash<std::basic_string_view<CharT>>()(std::basic_string_view<CharT>()) : Data->Hash);
+			}
+
+			/// <summary>
+			/// Checks if the string is empty
+			/// </summary>
+			/// <returns>if it is empty</returns>
+			bool IsEmpty() const
+			{
+				return Data == nullptr;
+			}
+
+			operator std::basic_string_view<CharT>() const { return GetView(); }
+
+			bool operator==(const InternedString& other) const { return Data == other.Data; }
+			bool operator!=(const InternedString& other) const { return Data != other.Data; }
+		};
+
+		/// <summary>
+		/// Stores every distinct string once in a shared arena and hands out InternedString handles to them.
+		/// meant for strings which repeat a lot (entry names, node names, status messages), each distinct string costs its characters once and every copy after that is just a pointer.
+		/// thread safe, interning something which is already there only takes a shared lock. strings stay until the interner gets destroyed, so don't intern endless unique strings (counters, timestamps)
+		/// </summary>
+		/// <typeparam name="CharT">- string type</typeparam>
+		template <typename CharT>
+		class Interner
+		{
+		private:
+			using Entry = typename InternedString<CharT>::Entry;
+
+			NosStdLib::Memory::ArenaResource Arena;								/* storage for the entries and their characters */
+			std::unordered_map<std::basic_string_view<CharT>, const Entry*> Table;	/* text (pointing into the arena) to its entry */
+			mutable std::shared_mutex TableMutex;									/* guards Arena and Table */
+		public:
+			/// <summary>
+			/// Creates the interner
+			/// </summary>
+			/// <param name="initialChunkSize">(default = 4096) - size in bytes of the first arena chunk</param>
+			Interner(const size_t& initialChunkSize = 4096) : Arena(initialChunkSize) {}
+
+			Interner(const Interner&) = delete;
+			Interner& operator=(const Interner&) = delete;
+
+			/// <summary>
+			/// Gets the handle for a string, adding it if it isn't in the interner yet
+			/// </summary>
+			/// <param name="text">- the string</param>
+			/// <returns>handle to the interned string</returns>
+			InternedString<CharT> Intern(std::basic_string_view<CharT> text)
+			{
+				if (text.empty())
+				{
+					return InternedString<CharT>();
+				}
+
+				{
+					std::shared_lock<std::shared_mutex> lock(TableMutex);
+					auto found = Table.find(text);
+					if (found != Table.end())
+						return InternedString<CharT>(found->second);
+				}
+
+				std::lock_guard<std::shared_mutex> lock(TableMutex);
+				auto found = Table.find(text); /* another thread could have added it between the locks */
+				if (found != Table.end())
+				{
+					return InternedString<CharT>(found->second);
+				}
+
+				Entry* entry = new (Arena.allocate(sizeof(Entry) + (text.size() + 1) * sizeof(CharT), alignof(Entry))) Entry;
+				entry->Hash = std::hash<std::basic_string_view<CharT>>()(text);
+				entry->Size = text.size();
+				CharT* characters = (CharT*)(entry + 1);
+				std::char_traits<CharT>::copy(characters, text.data(), text.size());
+				characters[text.size()] = (CharT)'\0';
+
+				Table.emplace(std::basic_string_view<CharT>(characters, text.size()), entry);
+				return InternedString<CharT>(entry);
+			}
+
+			/// <summary>
+			/// Gets the amount of distinct strings in the interner
+			/// </summary>
+			/// <returns>amount of strings</returns>
+			size_t GetCount() const
+			{
+				std::shared_lock<std::shared_mutex> lock(TableMutex);
+				return Table.size();
+			}
+
+			/// <summary>
+			/// Gets how many bytes of the arena the strings take up (headers included)
+			/// </summary>
+			/// <returns>bytes used</returns>
+			size_t GetBytesUsed() const
+			{
+				std::shared_lock<std::shared_mutex> lock(TableMutex);
+				return Arena.GetBytesAllocated();
+			}
+
+			/// <summary>
+			/// Gets the interner which the library's own classes (menu entry names, loading screen status messages) use
+			/// </summary>
+			/// <returns>reference to the global interner</returns>
+			static Interner& GetGlobal()
+			{
+				static Interner globalInterner;
+				return globalInterner;
+			}
+		};
+	#pragma endregion
 	}
 }
+
+namespace std
+{
+	/// <summary>
+	/// lets InternedString be used as a key in std::unordered_map/unordered_set, uses the stored hash
+	/// </summary>
+	template <typename CharT>
+	struct hash<NosStdLib::String::InternedString<CharT>>
+	{
+		size_t operator()(const NosStdLib::String::InternedString<CharT>& string) const noexcept
+		{
+			return string.GetHash();
+		}
+	};
+}
 #endif
\ No newline at end of file
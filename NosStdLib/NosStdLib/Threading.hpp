@@ -0,0 +1,252 @@
+#ifndef _THREADING_NOSSTDLIB_HPP_
+#define _THREADING_NOSSTDLIB_HPP_
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <latch>
+#include <exception>
+#include <memory>
+#include <algorithm>
+#include <stdint.h>
+
+namespace NosStdLib
+{
+	/// <summary>
+	/// how an algorithm (Sort, Transform, ForEach...) should be ran
+	/// </summary>
+	enum ExecutionPolicy : uint8_t
+	{
+		Sequential = 0,	/* run on the calling thread */
+		Parallel = 1,	/* split the array into chunks and run them on the global thread pool */
+	};
+
+	/// <summary>
+	/// namespace for items which are related to threading
+	/// </summary>
+	namespace Threading
+	{
+		/// <summary>
+		/// size of a cache line, chunks handed to different threads get split on this so 2 threads never write to the same line
+		/// </summary>
+		inline constexpr size_t CacheLineSize = 64;
+
+		/// <summary>
+		/// Fixed size pool of worker threads which run tasks from a shared queue
+		/// </summary>
+		class ThreadPool
+		{
+		private:
+			std::vector<std::thread> Workers;			/* the worker threads */
+			std::queue<std::function<void()>> Tasks;	/* tasks waiting to get ran */
+			std::mutex QueueMutex;						/* guards Tasks and Stopping */
+			std::condition_variable QueueCondition;		/* wakes the workers when a task gets added */
+			bool Stopping;								/* set when the pool gets destroyed */
+
+			/// <summary>
+			/// loop which every worker thread runs, takes tasks until the pool stops
+			/// </summary>
+			void WorkerLoop()
+			{
+				while (true)
+				{
+					std::function<void()> task;
+					{
+						std::unique_lock<std::mutex> lock(QueueMutex);
+						QueueCondition.wait(lock, [this] { return Stopping || !Tasks.empty(); });
+						if (Stopping && Tasks.empty())
+						{
+							return;
+						}
+						task = std::move(Tasks.front());
+						Tasks.pop();
+					}
+					task();
+				}
+			}
+		public:
+			/// <summary>
+			/// Creates the pool and starts the worker threads
+			/// </summary>
+			/// <param name="threadCount">(default = hardware_concurrency) - amount of worker threads</param>
+			ThreadPool(const unsigned int& threadCount = std::thread::hardware_concurrency())
+			{
+				Stopping = false;
+				unsigned int workerCount = (threadCount == 0 ? 1 : threadCount);
+				Workers.reserve(workerCount);
+				for (unsigned int i = 0; i < workerCount; i++)
+				{
+					Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+				}
+			}
+
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator=(const ThreadPool&) = delete;
+
+			/// <summary>
+			/// Finishes the tasks still in the queue and joins the worker threads
+			/// </summary>
+			~ThreadPool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(QueueMutex);
+					Stopping = true;
+				}
+				QueueCondition.notify_all();
+				for (std::thread& worker : Workers)
+				{
+					worker.join();
+				}
+			}
+
+			/// <summary>
+			/// Adds a task to the queue
+			/// </summary>
+			/// <param name="task">- function which will get ran on one of the workers</param>
+			void Submit(std::function<void()> task)
+			{
+				{
+					std::lock_guard<std::mutex> lock(QueueMutex);
+					Tasks.push(std::move(task));
+				}
+				QueueCondition.notify_one();
+			}
+
+			/// <summary>
+			/// Runs function(i) for every i in [0, taskCount) on the pool and waits until all of them are done.
+			/// the calling thread runs task 0 itself. if a task throws, the first exception gets rethrown on the calling thread.
+			/// WARNING: don't call this from inside a task of the same pool, every worker could end up waiting and nothing would run
+			/// </summary>
+			/// <param name="taskCount">- amount of tasks</param>
+			/// <param name="function">- function which takes the task index</param>
+			void RunTasks(const int& taskCount, const std::function<void(int)>& function)
+			{
+				if (taskCount <= 0)
+				{
+					return;
+				}
+
+				/* state shared between the calling thread and the tasks. every task holds a reference, so the latch stays alive until the last count_down is done even if the caller already returned */
+				struct RunState
+				{
+					std::latch Finished;							/* counts down once per task */
+					const std::function<void(int)>* Function;		/* only used before counting down, the caller waits until then */
+					std::exception_ptr FirstException;				/* first exception a task threw */
+					std::mutex ExceptionMutex;						/* guards FirstException */
+
+					RunState(const int& taskCount, const std::function<void(int)>* function) : Finished(taskCount), Function(function) {}
+
+					void RunTask(const int& index)
+					{
+						try
+						{
+							(*Function)(index);
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(ExceptionMutex);
+							if (!FirstException)
+							{
+								FirstException = std::current_exception();
+							}
+						}
+						Finished.count_down();
+					}
+				};
+
+				std::shared_ptr<RunState> state = std::make_shared<RunState>(taskCount, &function);
+
+				for (int i = 1; i < taskCount; i++)
+				{
+					try
+					{
+						Submit([state, i] { state->RunTask(i); });
+					}
+					catch (...)
+					{
+						/* the tasks which didn't get queued (and task 0) won't run, wait for the queued ones before leaving since they use function */
+						state->Finished.count_down(taskCount - i + 1);
+						state->Finished.wait();
+						throw;
+					}
+				}
+				state->RunTask(0);
+				state->Finished.wait();
+
+				if (state->FirstException)
+				{
+					std::rethrow_exception(state->FirstException);
+				}
+			}
+
+			/// <summary>
+			/// Gets the amount of worker threads
+			/// </summary>
+			/// <returns>amount of worker threads</returns>
+			int GetThreadCount() const
+			{
+				return (int)Workers.size();
+			}
+
+			/// <summary>
+			/// Gets the pool which the Parallel execution policy uses (created on first use with hardware_concurrency threads)
+			/// </summary>
+			/// <returns>reference to the global pool</returns>
+			static ThreadPool& GetGlobal()
+			{
+				static ThreadPool globalPool;
+				return globalPool;
+			}
+		};
+
+		/// <summary>
+		/// Splits an array into chunks for parallel work. every boundary (except the first and last) lands on the start of a cache line,
+		/// as long as the object size allows it, so threads writing next to each other never share a line
+		/// </summary>
+		/// <typeparam name="DataType">- datatype of the array</typeparam>
+		/// <param name="data">- pointer to the first object</param>
+		/// <param name="count">- amount of objects</param>
+		/// <param name="maxChunks">- maximum amount of chunks (usually thread count)</param>
+		/// <param name="minimumChunkSize">- smallest amount of objects in a chunk, less chunks get made if the array is too small</param>
+		/// <returns>chunk boundaries, chunk i is [boundaries[i], boundaries[i+1])</returns>
+		template<class DataType>
+		std::vector<int> SplitIntoChunks(const DataType* data, const int& count, const int& maxChunks, const int& minimumChunkSize)
+		{
+			std::vector<int> boundaries;
+			boundaries.push_back(0);
+
+			int chunkCount = (minimumChunkSize > 0 ? count / minimumChunkSize : count);
+			chunkCount = std::clamp(chunkCount, 1, (maxChunks > 0 ? maxChunks : 1));
+
+			/* how many objects fit in a cache line and how many objects until the first cache line boundary */
+			int lineObjects = 1, lineOffset = 0;
+			if constexpr (sizeof(DataType) < CacheLineSize && CacheLineSize % sizeof(DataType) == 0)
+			{
+				size_t misalignment = (size_t)((uintptr_t)data % CacheLineSize);
+				if (misalignment % sizeof(DataType) == 0)
+				{
+					lineObjects = (int)(CacheLineSize / sizeof(DataType));
+					lineOffset = (int)(((CacheLineSize - misalignment) % CacheLineSize) / sizeof(DataType));
+				}
+			}
+
+			for (int i = 1; i < chunkCount; i++)
+			{
+				long long boundary = (long long)count * i / chunkCount;
+				boundary = lineOffset + ((boundary - lineOffset + lineObjects - 1) / lineObjects) * lineObjects; /* round up to the next cache line */
+				if (boundary > boundaries.back() && boundary < count)
+				{
+					boundaries.push_back((int)boundary);
+				}
+			}
+
+			boundaries.push_back(count);
+			return boundaries;
+		}
+	}
+}
+
+#endif
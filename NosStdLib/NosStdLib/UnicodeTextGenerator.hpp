@@ -38,6 +38,7 @@ namespace NosStdLib
 			CONSOLE_SCREEN_BUFFER_INFO csbi;
 			GetConsoleScreenBufferInfo(consoleHandle, &csbi);
 
+			std::wstring lowerInput = NosStdLib::String::ToLower(input); /* lower cased once, so each letter only gets compared against 1 case */
 			std::wstring output;
 			int SpaceLenght = (((csbi.srWindow.Right - csbi.srWindow.Left + 1) / 2) - ((input.length() * 8) / 2));
 
@@ -47,143 +48,143 @@ namespace NosStdLib
 			//loop will print first layer
 			for (int i = 0; i < input.size(); i++)
 			{
-				if (input[i] == 'A' || input[i] == 'a')
+				if (lowerInput[i] == 'a')
 					output += L"  ___   ";
-				if (input[i] == 'B' || input[i] == 'b')
+				if (lowerInput[i] == 'b')
 					output += L" _____  ";
-				if (input[i] == 'C' || input[i] == 'c')
+				if (lowerInput[i] == 'c')
 					output += L" _____  ";
-				if (input[i] == 'D' || input[i] == 'd')
+				if (lowerInput[i] == 'd')
 					output += L" _____  ";
-				if (input[i] == 'E' || input[i] == 'e')
+				if (lowerInput[i] == 'e')
 					output += L" _____  ";
-				if (input[i] == 'F' || input[i] == 'f')
+				if (lowerInput[i] == 'f')
 					output += L" _____  ";
-				if (input[i] == 'G' || input[i] == 'g')
+				if (lowerInput[i] == 'g')
 					output += L" _____  ";
-				if (input[i] == 'H' || input[i] == 'h')
+				if (lowerInput[i] == 'h')
 					output += L" _   _  ";
-				if (input[i] == 'I' || input[i] == 'i')
+				if (lowerInput[i] == 'i')
 					output += L" _____  ";
-				if (input[i] == 'J' || input[i] == 'j')
+				if (lowerInput[i] == 'j')
 					output += L"   ___  ";
-				if (input[i] == 'K' || input[i] == 'k')
+				if (lowerInput[i] == 'k')
 					output += L" _   __ ";
-				if (input[i] == 'L' || input[i] == 'l')
+				if (lowerInput[i] == 'l')
 					output += L" _      ";
-				if (input[i] == 'M' || input[i] == 'm')
+				if (lowerInput[i] == 'm')
 					output += L" __  __  ";
-				if (input[i] == 'N' || input[i] == 'n')
+				if (lowerInput[i] == 'n')
 					output += L" _   _  ";
-				if (input[i] == 'O' || input[i] == 'o')
+				if (lowerInput[i] == 'o')
 					output += L" _____  ";
-				if (input[i] == 'P' || input[i] == 'p')
+				if (lowerInput[i] == 'p')
 					output += L" _____  ";
-				if (input[i] == 'Q' || input[i] == 'q')
+				if (lowerInput[i] == 'q')
 					output += L" _____  ";
-				if (input[i] == 'R' || input[i] == 'r')
+				if (lowerInput[i] == 'r')
 					output += L" _____  ";
-				if (input[i] == 'S' || input[i] == 's')
+				if (lowerInput[i] == 's')
 					output += L" _____  ";
-				if (input[i] == 'T' || input[i] == 't')
+				if (lowerInput[i] == 't')
 					output += L" _____  ";
-				if (input[i] == 'U' || input[i] == 'u')
+				if (lowerInput[i] == 'u')
 					output += L" _   _  ";
-				if (input[i] == 'V' || input[i] == 'v')
+				if (lowerInput[i] == 'v')
 					output += L" _   _  ";
-				if (input[i] == 'W' || input[i] == 'w')
+				if (lowerInput[i] == 'w')
 					output += L" _    _  ";
-				if (input[i] == 'X' || input[i] == 'x')
+				if (lowerInput[i] == 'x')
 					output += L"__   __ ";
-				if (input[i] == 'Y' || input[i] == 'y')
+				if (lowerInput[i] == 'y')
 					output += L"__   __ ";
-				if (input[i] == 'Z' || input[i] == 'z')
+				if (lowerInput[i] == 'z')
 					output += L" ______ ";
-				if (input[i] == ' ')
+				if (lowerInput[i] == ' ')
 					output += L"  ";
-				if (input[i] == '`')
+				if (lowerInput[i] == '`')
 					output += L" _  ";
-				if (input[i] == '~')
+				if (lowerInput[i] == '~')
 					output += L"      ";
-				if (input[i] == '1')
+				if (lowerInput[i] == '1')
 					output += L" __   ";
-				if (input[i] == '2')
+				if (lowerInput[i] == '2')
 					output += L" _____  ";
-				if (input[i] == '3')
+				if (lowerInput[i] == '3')
 					output += L" _____  ";
-				if (input[i] == '4')
+				if (lowerInput[i] == '4')
 					output += L"   ___  ";
-				if (input[i] == '5')
+				if (lowerInput[i] == '5')
 					output += L" _____  ";
-				if (input[i] == '6')
+				if (lowerInput[i] == '6')
 					output += L"  ____  ";
-				if (input[i] == '7')
+				if (lowerInput[i] == '7')
 					output += L" ______ ";
-				if (input[i] == '.')
+				if (lowerInput[i] == '.')
 					output += L"    ";
-				if (input[i] == '8')
+				if (lowerInput[i] == '8')
 					output += L" _____  ";
-				if (input[i] == '9')
+				if (lowerInput[i] == '9')
 					output += L" _____  ";
-				if (input[i] == '0')
+				if (lowerInput[i] == '0')
 					output += L" _____  ";
-				if (input[i] == '!')
+				if (lowerInput[i] == '!')
 					output += L" _  ";
-				if (input[i] == '@')
+				if (lowerInput[i] == '@')
 					output += L"   ____   ";
-				if (input[i] == '#')
+				if (lowerInput[i] == '#')
 					output += L"   _  _    ";
-				if (input[i] == '$')
+				if (lowerInput[i] == '$')
 					output += L"  _   ";
-				if (input[i] == '%')
+				if (lowerInput[i] == '%')
 					output += L" _   __ ";
-				if (input[i] == '^')
+				if (lowerInput[i] == '^')
 					output += L" /\\  ";
-				if (input[i] == '&')
+				if (lowerInput[i] == '&')
 					output += L"         ";
-				if (input[i] == '*')
+				if (lowerInput[i] == '*')
 					output += L"    _     ";
-				if (input[i] == '(')
+				if (lowerInput[i] == '(')
 					output += L"  __ ";
-				if (input[i] == ')')
+				if (lowerInput[i] == ')')
 					output += L"__   ";
-				if (input[i] == '-')
+				if (lowerInput[i] == '-')
 					output += L"         ";
-				if (input[i] == '_')
+				if (lowerInput[i] == '_')
 					output += L"         ";
-				if (input[i] == '=')
+				if (lowerInput[i] == '=')
 					output += L"         ";
-				if (input[i] == '+')
+				if (lowerInput[i] == '+')
 					output += L"        ";
-				if (input[i] == '[')
+				if (lowerInput[i] == '[')
 					output += L" ___  ";
-				if (input[i] == '{')
+				if (lowerInput[i] == '{')
 					output += L"   __ ";
-				if (input[i] == ']')
+				if (lowerInput[i] == ']')
 					output += L" ___  ";
-				if (input[i] == '}')
+				if (lowerInput[i] == '}')
 					output += L"__    ";
-				if (input[i] == '|')
+				if (lowerInput[i] == '|')
 					output += L" _  ";
-				if (input[i] == '\\')
+				if (lowerInput[i] == '\\')
 					output += L"__      ";
-				if (input[i] == ';')
+				if (lowerInput[i] == ';')
 					output += L" _  ";
-				if (input[i] == ':')
+				if (lowerInput[i] == ':')
 					output += L"    ";
-				if (input[i] == '\'')
+				if (lowerInput[i] == '\'')
 					output += L" _  ";
-				if (input[i] == '"')
+				if (lowerInput[i] == '"')
 					output += L" _ _  ";
-				if (input[i] == '<')
+				if (lowerInput[i] == '<')
 					output += L"   __ ";
-				if (input[i] == ',')
+				if (lowerInput[i] == ',')
 					output += L"    ";
-				if (input[i] == '>')
+				if (lowerInput[i] == '>')
 					output += L"__    ";
-				if (input[i] == '/')
+				if (lowerInput[i] == '/')
 					output += L"     __ ";
-				if (input[i] == '?')
+				if (lowerInput[i] == '?')
 					output += L" ___   ";
 			}
 			output += L"\n";
@@ -192,143 +193,143 @@ namespace NosStdLib
 			//loop will print second layer
 			for (int i = 0; i < input.size(); i++)
 			{
-				if (input[i] == 'A' || input[i] == 'a')
+				if (lowerInput[i] == 'a')
 					output += L" / _ \\  ";
-				if (input[i] == 'B' || input[i] == 'b')
+				if (lowerInput[i] == 'b')
 					output += L"| ___ \\ ";
-				if (input[i] == 'C' || input[i] == 'c')
+				if (lowerInput[i] == 'c')
 					output += L"/  __ \\ ";
-				if (input[i] == 'D' || input[i] == 'd')
+				if (lowerInput[i] == 'd')
 					output += L"|  _  \\ ";
-				if (input[i] == 'E' || input[i] == 'e')
+				if (lowerInput[i] == 'e')
 					output += L"|  ___| ";
-				if (input[i] == 'F' || input[i] == 'f')
+				if (lowerInput[i] == 'f')
 					output += L"|  ___| ";
-				if (input[i] == 'G' || input[i] == 'g')
+				if (lowerInput[i] == 'g')
 					output += L"|  __ \\ ";
-				if (input[i] == 'H' || input[i] == 'h')
+				if (lowerInput[i] == 'h')
 					output += L"| | | | ";
-				if (input[i] == 'I' || input[i] == 'i')
+				if (lowerInput[i] == 'i')
 					output += L"|_   _| ";
-				if (input[i] == 'J' || input[i] == 'j')
+				if (lowerInput[i] == 'j')
 					output += L"  |_  | ";
-				if (input[i] == 'K' || input[i] == 'k')
+				if (lowerInput[i] == 'k')
 					output += L"| | / / ";
-				if (input[i] == 'L' || input[i] == 'l')
+				if (lowerInput[i] == 'l')
 					output += L"| |     ";
-				if (input[i] == 'M' || input[i] == 'm')
+				if (lowerInput[i] == 'm')
 					output += L"|  \\/  | ";
-				if (input[i] == 'N' || input[i] == 'n')
+				if (lowerInput[i] == 'n')
 					output += L"| \\ | | ";
-				if (input[i] == 'O' || input[i] == 'o')
+				if (lowerInput[i] == 'o')
 					output += L"|  _  | ";
-				if (input[i] == 'P' || input[i] == 'p')
+				if (lowerInput[i] == 'p')
 					output += L"| ___ \\ ";
-				if (input[i] == 'Q' || input[i] == 'q')
+				if (lowerInput[i] == 'q')
 					output += L"|  _  | ";
-				if (input[i] == 'R' || input[i] == 'r')
+				if (lowerInput[i] == 'r')
 					output += L"| ___ \\ ";
-				if (input[i] == 'S' || input[i] == 's')
+				if (lowerInput[i] == 's')
 					output += L"/  ___| ";
-				if (input[i] == 'T' || input[i] == 't')
+				if (lowerInput[i] == 't')
 					output += L"|_   _| ";
-				if (input[i] == 'U' || input[i] == 'u')
+				if (lowerInput[i] == 'u')
 					output += L"| | | | ";
-				if (input[i] == 'V' || input[i] == 'v')
+				if (lowerInput[i] == 'v')
 					output += L"| | | | ";
-				if (input[i] == 'W' || input[i] == 'w')
+				if (lowerInput[i] == 'w')
 					output += L"| |  | | ";
-				if (input[i] == 'X' || input[i] == 'x')
+				if (lowerInput[i] == 'x')
 					output += L"\\ \\ / / ";
-				if (input[i] == 'Y' || input[i] == 'y')
+				if (lowerInput[i] == 'y')
 					output += L"\\ \\ / / ";
-				if (input[i] == 'Z' || input[i] == 'z')
+				if (lowerInput[i] == 'z')
 					output += L"|___  / ";
-				if (input[i] == ' ')
+				if (lowerInput[i] == ' ')
 					output += L"  ";
-				if (input[i] == '`')
+				if (lowerInput[i] == '`')
 					output += L"( ) ";
-				if (input[i] == '~')
+				if (lowerInput[i] == '~')
 					output += L"      ";
-				if (input[i] == '1')
+				if (lowerInput[i] == '1')
 					output += L"/  |  ";
-				if (input[i] == '2')
+				if (lowerInput[i] == '2')
 					output += L"/ __  \\ ";
-				if (input[i] == '3')
+				if (lowerInput[i] == '3')
 					output += L"|____ | ";
-				if (input[i] == '4')
+				if (lowerInput[i] == '4')
 					output += L"  /   | ";
-				if (input[i] == '5')
+				if (lowerInput[i] == '5')
 					output += L"|  ___| ";
-				if (input[i] == '6')
+				if (lowerInput[i] == '6')
 					output += L" / ___| ";
-				if (input[i] == '7')
+				if (lowerInput[i] == '7')
 					output += L"|___  / ";
-				if (input[i] == '.')
+				if (lowerInput[i] == '.')
 					output += L"    ";
-				if (input[i] == '8')
+				if (lowerInput[i] == '8')
 					output += L"|  _  | ";
-				if (input[i] == '9')
+				if (lowerInput[i] == '9')
 					output += L"|  _  | ";
-				if (input[i] == '0')
+				if (lowerInput[i] == '0')
 					output += L"|  _  | ";
-				if (input[i] == '!')
+				if (lowerInput[i] == '!')
 					output += L"| | ";
-				if (input[i] == '@')
+				if (lowerInput[i] == '@')
 					output += L"  / __ \\  ";
-				if (input[i] == '#')
+				if (lowerInput[i] == '#')
 					output += L" _| || |_  ";
-				if (input[i] == '$')
+				if (lowerInput[i] == '$')
 					output += L" | |  ";
-				if (input[i] == '%')
+				if (lowerInput[i] == '%')
 					output += L"(_) / / ";
-				if (input[i] == '^')
+				if (lowerInput[i] == '^')
 					output += L"|/\\| ";
-				if (input[i] == '&')
+				if (lowerInput[i] == '&')
 					output += L"  ___    ";
-				if (input[i] == '*')
+				if (lowerInput[i] == '*')
 					output += L" /\\| |/\\  ";
-				if (input[i] == '(')
+				if (lowerInput[i] == '(')
 					output += L" / / ";
-				if (input[i] == ')')
+				if (lowerInput[i] == ')')
 					output += L"\\ \\  ";
-				if (input[i] == '-')
+				if (lowerInput[i] == '-')
 					output += L"         ";
-				if (input[i] == '_')
+				if (lowerInput[i] == '_')
 					output += L"         ";
-				if (input[i] == '=')
+				if (lowerInput[i] == '=')
 					output += L" ______  ";
-				if (input[i] == '+')
+				if (lowerInput[i] == '+')
 					output += L"   _    ";
-				if (input[i] == '[')
+				if (lowerInput[i] == '[')
 					output += L"|  _| ";
-				if (input[i] == '{')
+				if (lowerInput[i] == '{')
 					output += L"  / / ";
-				if (input[i] == ']')
+				if (lowerInput[i] == ']')
 					output += L"|_  | ";
-				if (input[i] == '}')
+				if (lowerInput[i] == '}')
 					output += L"\\ \\   ";
-				if (input[i] == '|')
+				if (lowerInput[i] == '|')
 					output += L"| | ";
-				if (input[i] == '\\')
+				if (lowerInput[i] == '\\')
 					output += L"\\ \\     ";
-				if (input[i] == ';')
+				if (lowerInput[i] == ';')
 					output += L"(_) ";
-				if (input[i] == ':')
+				if (lowerInput[i] == ':')
 					output += L" _  ";
-				if (input[i] == '\'')
+				if (lowerInput[i] == '\'')
 					output += L"( ) ";
-				if (input[i] == '"')
+				if (lowerInput[i] == '"')
 					output += L"( | ) ";
-				if (input[i] == '<')
+				if (lowerInput[i] == '<')
 					output += L"  / / ";
-				if (input[i] == ',')
+				if (lowerInput[i] == ',')
 					output += L"    ";
-				if (input[i] == '>')
+				if (lowerInput[i] == '>')
 					output += L"\\ \\   ";
-				if (input[i] == '/')
+				if (lowerInput[i] == '/')
 					output += L"    / / ";
-				if (input[i] == '?')
+				if (lowerInput[i] == '?')
 					output += L"|__ \\  ";
 			}
 			output += L"\n";
@@ -337,143 +338,143 @@ namespace NosStdLib
 			//loop will print third layer
 			for (int i = 0; i < input.size(); i++)
 			{
-				if (input[i] == 'A' || input[i] == 'a')
+				if (lowerInput[i] == 'a')
 					output += L"/ /_\\ \\ ";
-				if (input[i] == 'B' || input[i] == 'b')
+				if (lowerInput[i] == 'b')
 					output += L"| |_/ / ";
-				if (input[i] == 'C' || input[i] == 'c')
+				if (lowerInput[i] == 'c')
 					output += L"| /  \\/ ";
-				if (input[i] == 'D' || input[i] == 'd')
+				if (lowerInput[i] == 'd')
 					output += L"| | | | ";
-				if (input[i] == 'E' || input[i] == 'e')
+				if (lowerInput[i] == 'e')
 					output += L"| |__   ";
-				if (input[i] == 'F' || input[i] == 'f')
+				if (lowerInput[i] == 'f')
 					output += L"| |_    ";
-				if (input[i] == 'G' || input[i] == 'g')
+				if (lowerInput[i] == 'g')
 					output += L"| |  \\/ ";
-				if (input[i] == 'H' || input[i] == 'h')
+				if (lowerInput[i] == 'h')
 					output += L"| |_| | ";
-				if (input[i] == 'I' || input[i] == 'i')
+				if (lowerInput[i] == 'i')
 					output += L"  | |   ";
-				if (input[i] == 'J' || input[i] == 'j')
+				if (lowerInput[i] == 'j')
 					output += L"    | | ";
-				if (input[i] == 'K' || input[i] == 'k')
+				if (lowerInput[i] == 'k')
 					output += L"| |/ /  ";
-				if (input[i] == 'L' || input[i] == 'l')
+				if (lowerInput[i] == 'l')
 					output += L"| |     ";
-				if (input[i] == 'M' || input[i] == 'm')
+				if (lowerInput[i] == 'm')
 					output += L"| .  . | ";
-				if (input[i] == 'N' || input[i] == 'n')
+				if (lowerInput[i] == 'n')
 					output += L"|  \\| | ";
-				if (input[i] == 'O' || input[i] == 'o')
+				if (lowerInput[i] == 'o')
 					output += L"| | | | ";
-				if (input[i] == 'P' || input[i] == 'p')
+				if (lowerInput[i] == 'p')
 					output += L"| |_/ / ";
-				if (input[i] == 'Q' || input[i] == 'q')
+				if (lowerInput[i] == 'q')
 					output += L"| | | | ";
-				if (input[i] == 'R' || input[i] == 'r')
+				if (lowerInput[i] == 'r')
 					output += L"| |_/ / ";
-				if (input[i] == 'S' || input[i] == 's')
+				if (lowerInput[i] == 's')
 					output += L"\\ `--.  ";
-				if (input[i] == 'T' || input[i] == 't')
+				if (lowerInput[i] == 't')
 					output += L"  | |   ";
-				if (input[i] == 'U' || input[i] == 'u')
+				if (lowerInput[i] == 'u')
 					output += L"| | | | ";
-				if (input[i] == 'V' || input[i] == 'v')
+				if (lowerInput[i] == 'v')
 					output += L"| | | | ";
-				if (input[i] == 'W' || input[i] == 'w')
+				if (lowerInput[i] == 'w')
 					output += L"| |  | | ";
-				if (input[i] == 'X' || input[i] == 'x')
+				if (lowerInput[i] == 'x')
 					output += L" \\ V /  ";
-				if (input[i] == 'Y' || input[i] == 'y')
+				if (lowerInput[i] == 'y')
 					output += L" \\ V /  ";
-				if (input[i] == 'Z' || input[i] == 'z')
+				if (lowerInput[i] == 'z')
 					output += L"   / /  ";
-				if (input[i] == ' ')
+				if (lowerInput[i] == ' ')
 					output += L"  ";
-				if (input[i] == '`')
+				if (lowerInput[i] == '`')
 					output += L" \\| ";
-				if (input[i] == '~')
+				if (lowerInput[i] == '~')
 					output += L" /\\/| ";
-				if (input[i] == '1')
+				if (lowerInput[i] == '1')
 					output += L"`| |  ";
-				if (input[i] == '2')
+				if (lowerInput[i] == '2')
 					output += L"`' / /' ";
-				if (input[i] == '3')
+				if (lowerInput[i] == '3')
 					output += L"    / / ";
-				if (input[i] == '4')
+				if (lowerInput[i] == '4')
 					output += L" / /| | ";
-				if (input[i] == '5')
+				if (lowerInput[i] == '5')
 					output += L"|___ \\  ";
-				if (input[i] == '6')
+				if (lowerInput[i] == '6')
 					output += L"/ /___  ";
-				if (input[i] == '7')
+				if (lowerInput[i] == '7')
 					output += L"   / /  ";
-				if (input[i] == '.')
+				if (lowerInput[i] == '.')
 					output += L"    ";
-				if (input[i] == '8')
+				if (lowerInput[i] == '8')
 					output += L" \\ V /  ";
-				if (input[i] == '9')
+				if (lowerInput[i] == '9')
 					output += L"| |_| | ";
-				if (input[i] == '0')
+				if (lowerInput[i] == '0')
 					output += L"| |/' | ";
-				if (input[i] == '!')
+				if (lowerInput[i] == '!')
 					output += L"| | ";
-				if (input[i] == '@')
+				if (lowerInput[i] == '@')
 					output += L" / / _` | ";
-				if (input[i] == '#')
+				if (lowerInput[i] == '#')
 					output += L"|_  __  _| ";
-				if (input[i] == '$')
+				if (lowerInput[i] == '$')
 					output += L"/ __) ";
-				if (input[i] == '%')
+				if (lowerInput[i] == '%')
 					output += L"   / /  ";
-				if (input[i] == '^')
+				if (lowerInput[i] == '^')
 					output += L"     ";
-				if (input[i] == '&')
+				if (lowerInput[i] == '&')
 					output += L" ( _ )   ";
-				if (input[i] == '*')
+				if (lowerInput[i] == '*')
 					output += L" \\ ` ' /  ";
-				if (input[i] == '(')
+				if (lowerInput[i] == '(')
 					output += L"| |  ";
-				if (input[i] == ')')
+				if (lowerInput[i] == ')')
 					output += L" | | ";
-				if (input[i] == '-')
+				if (lowerInput[i] == '-')
 					output += L" ______  ";
-				if (input[i] == '_')
+				if (lowerInput[i] == '_')
 					output += L"         ";
-				if (input[i] == '=')
+				if (lowerInput[i] == '=')
 					output += L"|______| ";
-				if (input[i] == '+')
+				if (lowerInput[i] == '+')
 					output += L" _| |_  ";
-				if (input[i] == '[')
+				if (lowerInput[i] == '[')
 					output += L"| |   ";
-				if (input[i] == '{')
+				if (lowerInput[i] == '{')
 					output += L" | |  ";
-				if (input[i] == ']')
+				if (lowerInput[i] == ']')
 					output += L"  | | ";
-				if (input[i] == '}')
+				if (lowerInput[i] == '}')
 					output += L" | |  ";
-				if (input[i] == '|')
+				if (lowerInput[i] == '|')
 					output += L"| | ";
-				if (input[i] == '\\')
+				if (lowerInput[i] == '\\')
 					output += L" \\ \\    ";
-				if (input[i] == ';')
+				if (lowerInput[i] == ';')
 					output += L"    ";
-				if (input[i] == ':')
+				if (lowerInput[i] == ':')
 					output += L"(_) ";
-				if (input[i] == '\'')
+				if (lowerInput[i] == '\'')
 					output += L"|/  ";
-				if (input[i] == '"')
+				if (lowerInput[i] == '"')
 					output += L" V V  ";
-				if (input[i] == '<')
+				if (lowerInput[i] == '<')
 					output += L" / /  ";
-				if (input[i] == ',')
+				if (lowerInput[i] == ',')
 					output += L"    ";
-				if (input[i] == '>')
+				if (lowerInput[i] == '>')
 					output += L" \\ \\  ";
-				if (input[i] == '/')
+				if (lowerInput[i] == '/')
 					output += L"   / /  ";
-				if (input[i] == '?')
+				if (lowerInput[i] == '?')
 					output += L"   ) | ";
 			}
 			output += L"\n";
@@ -482,143 +483,143 @@ namespace NosStdLib
 			//loop will print fourth layer
 			for (int i = 0; i < input.size(); i++)
 			{
-				if (input[i] == 'A' || input[i] == 'a')
+				if (lowerInput[i] == 'a')
 					output += L"|  _  | ";
-				if (input[i] == 'B' || input[i] == 'b')
+				if (lowerInput[i] == 'b')
 					output += L"| ___ \\ ";
-				if (input[i] == 'C' || input[i] == 'c')
+				if (lowerInput[i] == 'c')
 					output += L"| |     ";
-				if (input[i] == 'D' || input[i] == 'd')
+				if (lowerInput[i] == 'd')
 					output += L"| | | | ";
-				if (input[i] == 'E' || input[i] == 'e')
+				if (lowerInput[i] == 'e')
 					output += L"|  __|  ";
-				if (input[i] == 'F' || input[i] == 'f')
+				if (lowerInput[i] == 'f')
 					output += L"|  _|   ";
-				if (input[i] == 'G' || input[i] == 'g')
+				if (lowerInput[i] == 'g')
 					output += L"| | __  ";
-				if (input[i] == 'H' || input[i] == 'h')
+				if (lowerInput[i] == 'h')
 					output += L"|  _  | ";
-				if (input[i] == 'I' || input[i] == 'i')
+				if (lowerInput[i] == 'i')
 					output += L"  | |   ";
-				if (input[i] == 'J' || input[i] == 'j')
+				if (lowerInput[i] == 'j')
 					output += L"    | | ";
-				if (input[i] == 'K' || input[i] == 'k')
+				if (lowerInput[i] == 'k')
 					output += L"|    \\  ";
-				if (input[i] == 'L' || input[i] == 'l')
+				if (lowerInput[i] == 'l')
 					output += L"| |     ";
-				if (input[i] == 'M' || input[i] == 'm')
+				if (lowerInput[i] == 'm')
 					output += L"| |\\/| | ";
-				if (input[i] == 'N' || input[i] == 'n')
+				if (lowerInput[i] == 'n')
 					output += L"| . ` | ";
-				if (input[i] == 'O' || input[i] == 'o')
+				if (lowerInput[i] == 'o')
 					output += L"| | | | ";
-				if (input[i] == 'P' || input[i] == 'p')
+				if (lowerInput[i] == 'p')
 					output += L"|  __/  ";
-				if (input[i] == 'Q' || input[i] == 'q')
+				if (lowerInput[i] == 'q')
 					output += L"| | | | ";
-				if (input[i] == 'R' || input[i] == 'r')
+				if (lowerInput[i] == 'r')
 					output += L"|    /  ";
-				if (input[i] == 'S' || input[i] == 's')
+				if (lowerInput[i] == 's')
 					output += L" `--. \\ ";
-				if (input[i] == 'T' || input[i] == 't')
+				if (lowerInput[i] == 't')
 					output += L"  | |   ";
-				if (input[i] == 'U' || input[i] == 'u')
+				if (lowerInput[i] == 'u')
 					output += L"| | | | ";
-				if (input[i] == 'V' || input[i] == 'v')
+				if (lowerInput[i] == 'v')
 					output += L"| | | | ";
-				if (input[i] == 'W' || input[i] == 'w')
+				if (lowerInput[i] == 'w')
 					output += L"| |/\\| | ";
-				if (input[i] == 'X' || input[i] == 'x')
+				if (lowerInput[i] == 'x')
 					output += L" / ^ \\  ";
-				if (input[i] == 'Y' || input[i] == 'y')
+				if (lowerInput[i] == 'y')
 					output += L"  \\ /   ";
-				if (input[i] == 'Z' || input[i] == 'z')
+				if (lowerInput[i] == 'z')
 					output += L"  / /   ";
-				if (input[i] == ' ')
+				if (lowerInput[i] == ' ')
 					output += L"  ";
-				if (input[i] == '`')
+				if (lowerInput[i] == '`')
 					output += L"    ";
-				if (input[i] == '~')
+				if (lowerInput[i] == '~')
 					output += L"|/\\/  ";
-				if (input[i] == '1')
+				if (lowerInput[i] == '1')
 					output += L" | |  ";
-				if (input[i] == '2')
+				if (lowerInput[i] == '2')
 					output += L"  / /   ";
-				if (input[i] == '3')
+				if (lowerInput[i] == '3')
 					output += L"    \\ \\ ";
-				if (input[i] == '4')
+				if (lowerInput[i] == '4')
 					output += L"/ /_| | ";
-				if (input[i] == '5')
+				if (lowerInput[i] == '5')
 					output += L"    \\ \\ ";
-				if (input[i] == '6')
+				if (lowerInput[i] == '6')
 					output += L"| ___ \\ ";
-				if (input[i] == '7')
+				if (lowerInput[i] == '7')
 					output += L"  / /   ";
-				if (input[i] == '.')
+				if (lowerInput[i] == '.')
 					output += L"    ";
-				if (input[i] == '8')
+				if (lowerInput[i] == '8')
 					output += L" / _ \\  ";
-				if (input[i] == '9')
+				if (lowerInput[i] == '9')
 					output += L"\\____ | ";
-				if (input[i] == '0')
+				if (lowerInput[i] == '0')
 					output += L"|  /| | ";
-				if (input[i] == '!')
+				if (lowerInput[i] == '!')
 					output += L"| | ";
-				if (input[i] == '@')
+				if (lowerInput[i] == '@')
 					output += L"| | (_| | ";
-				if (input[i] == '#')
+				if (lowerInput[i] == '#')
 					output += L" _| || |_  ";
-				if (input[i] == '$')
+				if (lowerInput[i] == '$')
 					output += L"\\__ \\ ";
-				if (input[i] == '%')
+				if (lowerInput[i] == '%')
 					output += L"  / /   ";
-				if (input[i] == '^')
+				if (lowerInput[i] == '^')
 					output += L"     ";
-				if (input[i] == '&')
+				if (lowerInput[i] == '&')
 					output += L" / _ \\/\\ ";
-				if (input[i] == '*')
+				if (lowerInput[i] == '*')
 					output += L"|_     _| ";
-				if (input[i] == '(')
+				if (lowerInput[i] == '(')
 					output += L"| |  ";
-				if (input[i] == ')')
+				if (lowerInput[i] == ')')
 					output += L" | | ";
-				if (input[i] == '-')
+				if (lowerInput[i] == '-')
 					output += L"|______| ";
-				if (input[i] == '_')
+				if (lowerInput[i] == '_')
 					output += L"         ";
-				if (input[i] == '=')
+				if (lowerInput[i] == '=')
 					output += L" ______  ";
-				if (input[i] == '+')
+				if (lowerInput[i] == '+')
 					output += L"|_   _| ";
-				if (input[i] == '[')
+				if (lowerInput[i] == '[')
 					output += L"| |   ";
-				if (input[i] == '{')
+				if (lowerInput[i] == '{')
 					output += L"< <   ";
-				if (input[i] == ']')
+				if (lowerInput[i] == ']')
 					output += L"  | | ";
-				if (input[i] == '}')
+				if (lowerInput[i] == '}')
 					output += L"  > > ";
-				if (input[i] == '|')
+				if (lowerInput[i] == '|')
 					output += L"| | ";
-				if (input[i] == '\\')
+				if (lowerInput[i] == '\\')
 					output += L"  \\ \\   ";
-				if (input[i] == ';')
+				if (lowerInput[i] == ';')
 					output += L" _  ";
-				if (input[i] == ':')
+				if (lowerInput[i] == ':')
 					output += L"    ";
-				if (input[i] == '\'')
+				if (lowerInput[i] == '\'')
 					output += L"    ";
-				if (input[i] == '"')
+				if (lowerInput[i] == '"')
 					output += L"      ";
-				if (input[i] == '<')
+				if (lowerInput[i] == '<')
 					output += L"< <   ";
-				if (input[i] == ',')
+				if (lowerInput[i] == ',')
 					output += L" _  ";
-				if (input[i] == '>')
+				if (lowerInput[i] == '>')
 					output += L"  > > ";
-				if (input[i] == '/')
+				if (lowerInput[i] == '/')
 					output += L"  / /   ";
-				if (input[i] == '?')
+				if (lowerInput[i] == '?')
 					output += L"  / /  ";
 			}
 			output += L"\n";
@@ -627,143 +628,143 @@ namespace NosStdLib
 			//loop will print fifth layer
 			for (int i = 0; i < input.size(); i++)
 			{
-				if (input[i] == 'A' || input[i] == 'a')
+				if (lowerInput[i] == 'a')
 					output += L"| | | | ";
-				if (input[i] == 'B' || input[i] == 'b')
+				if (lowerInput[i] == 'b')
 					output += L"| |_/ / ";
-				if (input[i] == 'C' || input[i] == 'c')
+				if (lowerInput[i] == 'c')
 					output += L"| \\__/\\ ";
-				if (input[i] == 'D' || input[i] == 'd')
+				if (lowerInput[i] == 'd')
 					output += L"| |/ /  ";
-				if (input[i] == 'E' || input[i] == 'e')
+				if (lowerInput[i] == 'e')
 					output += L"| |___  ";
-				if (input[i] == 'F' || input[i] == 'f')
+				if (lowerInput[i] == 'f')
 					output += L"| |     ";
-				if (input[i] == 'G' || input[i] == 'g')
+				if (lowerInput[i] == 'g')
 					output += L"| |_\\ \\ ";
-				if (input[i] == 'H' || input[i] == 'h')
+				if (lowerInput[i] == 'h')
 					output += L"| | | | ";
-				if (input[i] == 'I' || input[i] == 'i')
+				if (lowerInput[i] == 'i')
 					output += L" _| |_  ";
-				if (input[i] == 'J' || input[i] == 'j')
+				if (lowerInput[i] == 'j')
 					output += L"/\\__/ / ";
-				if (input[i] == 'K' || input[i] == 'k')
+				if (lowerInput[i] == 'k')
 					output += L"| |\\  \\ ";
-				if (input[i] == 'L' || input[i] == 'l')
+				if (lowerInput[i] == 'l')
 					output += L"| |____ ";
-				if (input[i] == 'M' || input[i] == 'm')
+				if (lowerInput[i] == 'm')
 					output += L"| |  | | ";
-				if (input[i] == 'N' || input[i] == 'n')
+				if (lowerInput[i] == 'n')
 					output += L"| |\\  | ";
-				if (input[i] == 'O' || input[i] == 'o')
+				if (lowerInput[i] == 'o')
 					output += L"\\ \\_/ / ";
-				if (input[i] == 'P' || input[i] == 'p')
+				if (lowerInput[i] == 'p')
 					output += L"| |     ";
-				if (input[i] == 'Q' || input[i] == 'q')
+				if (lowerInput[i] == 'q')
 					output += L"\\ \\/' / ";
-				if (input[i] == 'R' || input[i] == 'r')
+				if (lowerInput[i] == 'r')
 					output += L"| |\\ \\  ";
-				if (input[i] == 'S' || input[i] == 's')
+				if (lowerInput[i] == 's')
 					output += L"/\\__/ / ";
-				if (input[i] == 'T' || input[i] == 't')
+				if (lowerInput[i] == 't')
 					output += L"  | |   ";
-				if (input[i] == 'U' || input[i] == 'u')
+				if (lowerInput[i] == 'u')
 					output += L"| |_| | ";
-				if (input[i] == 'V' || input[i] == 'v')
+				if (lowerInput[i] == 'v')
 					output += L"\\ \\_/ / ";
-				if (input[i] == 'W' || input[i] == 'w')
+				if (lowerInput[i] == 'w')
 					output += L"\\  /\\  / ";
-				if (input[i] == 'X' || input[i] == 'x')
+				if (lowerInput[i] == 'x')
 					output += L"/ / \\ \\ ";
-				if (input[i] == 'Y' || input[i] == 'y')
+				if (lowerInput[i] == 'y')
 					output += L"  | |   ";
-				if (input[i] == 'Z' || input[i] == 'z')
+				if (lowerInput[i] == 'z')
 					output += L"./ /___ ";
-				if (input[i] == ' ')
+				if (lowerInput[i] == ' ')
 					output += L"  ";
-				if (input[i] == '`')
+				if (lowerInput[i] == '`')
 					output += L"    ";
-				if (input[i] == '~')
+				if (lowerInput[i] == '~')
 					output += L"      ";
-				if (input[i] == '1')
+				if (lowerInput[i] == '1')
 					output += L"_| |_ ";
-				if (input[i] == '2')
+				if (lowerInput[i] == '2')
 					output += L"./ /___ ";
-				if (input[i] == '3')
+				if (lowerInput[i] == '3')
 					output += L".___/ / ";
-				if (input[i] == '4')
+				if (lowerInput[i] == '4')
 					output += L"\\___  | ";
-				if (input[i] == '5')
+				if (lowerInput[i] == '5')
 					output += L"/\\__/ / ";
-				if (input[i] == '6')
+				if (lowerInput[i] == '6')
 					output += L"| \\_/ | ";
-				if (input[i] == '7')
+				if (lowerInput[i] == '7')
 					output += L"./ /    ";
-				if (input[i] == '.')
+				if (lowerInput[i] == '.')
 					output += L" _  ";
-				if (input[i] == '8')
+				if (lowerInput[i] == '8')
 					output += L"| |_| | ";
-				if (input[i] == '9')
+				if (lowerInput[i] == '9')
 					output += L".___/ / ";
-				if (input[i] == '0')
+				if (lowerInput[i] == '0')
 					output += L"\\ |_/ / ";
-				if (input[i] == '!')
+				if (lowerInput[i] == '!')
 					output += L"|_| ";
-				if (input[i] == '@')
+				if (lowerInput[i] == '@')
 					output += L" \\ \\__,_| ";
-				if (input[i] == '#')
+				if (lowerInput[i] == '#')
 					output += L"|_  __  _| ";
-				if (input[i] == '$')
+				if (lowerInput[i] == '$')
 					output += L"(   / ";
-				if (input[i] == '%')
+				if (lowerInput[i] == '%')
 					output += L" / / _  ";
-				if (input[i] == '^')
+				if (lowerInput[i] == '^')
 					output += L"     ";
-				if (input[i] == '&')
+				if (lowerInput[i] == '&')
 					output += L"| (_>  < ";
-				if (input[i] == '*')
+				if (lowerInput[i] == '*')
 					output += L" / , . \\  ";
-				if (input[i] == '(')
+				if (lowerInput[i] == '(')
 					output += L"| |  ";
-				if (input[i] == ')')
+				if (lowerInput[i] == ')')
 					output += L" | | ";
-				if (input[i] == '-')
+				if (lowerInput[i] == '-')
 					output += L"         ";
-				if (input[i] == '_')
+				if (lowerInput[i] == '_')
 					output += L" ______  ";
-				if (input[i] == '=')
+				if (lowerInput[i] == '=')
 					output += L"|______| ";
-				if (input[i] == '+')
+				if (lowerInput[i] == '+')
 					output += L"  |_|   ";
-				if (input[i] == '[')
+				if (lowerInput[i] == '[')
 					output += L"| |_  ";
-				if (input[i] == '{')
+				if (lowerInput[i] == '{')
 					output += L" | |  ";
-				if (input[i] == ']')
+				if (lowerInput[i] == ']')
 					output += L" _| | ";
-				if (input[i] == '}')
+				if (lowerInput[i] == '}')
 					output += L" | |  ";
-				if (input[i] == '|')
+				if (lowerInput[i] == '|')
 					output += L"| | ";
-				if (input[i] == '\\')
+				if (lowerInput[i] == '\\')
 					output += L"   \\ \\  ";
-				if (input[i] == ';')
+				if (lowerInput[i] == ';')
 					output += L"( ) ";
-				if (input[i] == ':')
+				if (lowerInput[i] == ':')
 					output += L" _  ";
-				if (input[i] == '\'')
+				if (lowerInput[i] == '\'')
 					output += L"    ";
-				if (input[i] == '"')
+				if (lowerInput[i] == '"')
 					output += L"      ";
-				if (input[i] == '<')
+				if (lowerInput[i] == '<')
 					output += L" \\ \\  ";
-				if (input[i] == ',')
+				if (lowerInput[i] == ',')
 					output += L"( ) ";
-				if (input[i] == '>')
+				if (lowerInput[i] == '>')
 					output += L" / /  ";
-				if (input[i] == '/')
+				if (lowerInput[i] == '/')
 					output += L" / /    ";
-				if (input[i] == '?')
+				if (lowerInput[i] == '?')
 					output += L" |_|   ";
 			}
 			output += L"\n";
@@ -772,143 +773,143 @@ namespace NosStdLib
 			//loop will print sixth layer
 			for (int i = 0; i < input.size(); i++)
 			{
-				if (input[i] == 'A' || input[i] == 'a')
+				if (lowerInput[i] == 'a')
 					output += L"\\_| |_/ ";
-				if (input[i] == 'B' || input[i] == 'b')
+				if (lowerInput[i] == 'b')
 					output += L"\\____/  ";
-				if (input[i] == 'C' || input[i] == 'c')
+				if (lowerInput[i] == 'c')
 					output += L" \\____/ ";
-				if (input[i] == 'D' || input[i] == 'd')
+				if (lowerInput[i] == 'd')
 					output += L"|___/   ";
-				if (input[i] == 'E' || input[i] == 'e')
+				if (lowerInput[i] == 'e')
 					output += L"\\____/  ";
-				if (input[i] == 'F' || input[i] == 'f')
+				if (lowerInput[i] == 'f')
 					output += L"\\_|     ";
-				if (input[i] == 'G' || input[i] == 'g')
+				if (lowerInput[i] == 'g')
 					output += L" \\____/ ";
-				if (input[i] == 'H' || input[i] == 'h')
+				if (lowerInput[i] == 'h')
 					output += L"\\_| |_/ ";
-				if (input[i] == 'I' || input[i] == 'i')
+				if (lowerInput[i] == 'i')
 					output += L" \\___/  ";
-				if (input[i] == 'J' || input[i] == 'j')
+				if (lowerInput[i] == 'j')
 					output += L"\\____/  ";
-				if (input[i] == 'K' || input[i] == 'k')
+				if (lowerInput[i] == 'k')
 					output += L"\\_| \\_/ ";
-				if (input[i] == 'L' || input[i] == 'l')
+				if (lowerInput[i] == 'l')
 					output += L"\\_____/ ";
-				if (input[i] == 'M' || input[i] == 'm')
+				if (lowerInput[i] == 'm')
 					output += L"\\_|  |_/ ";
-				if (input[i] == 'N' || input[i] == 'n')
+				if (lowerInput[i] == 'n')
 					output += L"\\_| \\_/ ";
-				if (input[i] == 'O' || input[i] == 'o')
+				if (lowerInput[i] == 'o')
 					output += L" \\___/  ";
-				if (input[i] == 'P' || input[i] == 'p')
+				if (lowerInput[i] == 'p')
 					output += L"\\_|     ";
-				if (input[i] == 'Q' || input[i] == 'q')
+				if (lowerInput[i] == 'q')
 					output += L" \\_/\\_\\ ";
-				if (input[i] == 'R' || input[i] == 'r')
+				if (lowerInput[i] == 'r')
 					output += L"\\_| \\_| ";
-				if (input[i] == 'S' || input[i] == 's')
+				if (lowerInput[i] == 's')
 					output += L"\\____/  ";
-				if (input[i] == 'T' || input[i] == 't')
+				if (lowerInput[i] == 't')
 					output += L"  \\_/   ";
-				if (input[i] == 'U' || input[i] == 'u')
+				if (lowerInput[i] == 'u')
 					output += L" \\___/  ";
-				if (input[i] == 'V' || input[i] == 'v')
+				if (lowerInput[i] == 'v')
 					output += L" \\___/  ";
-				if (input[i] == 'W' || input[i] == 'w')
+				if (lowerInput[i] == 'w')
 					output += L" \\/  \\/  ";
-				if (input[i] == 'X' || input[i] == 'x')
+				if (lowerInput[i] == 'x')
 					output += L"\\/   \\/ ";
-				if (input[i] == 'Y' || input[i] == 'y')
+				if (lowerInput[i] == 'y')
 					output += L"  \\_/   ";
-				if (input[i] == 'Z' || input[i] == 'z')
+				if (lowerInput[i] == 'z')
 					output += L"\\_____/ ";
-				if (input[i] == ' ')
+				if (lowerInput[i] == ' ')
 					output += L"  ";
-				if (input[i] == '`')
+				if (lowerInput[i] == '`')
 					output += L"    ";
-				if (input[i] == '~')
+				if (lowerInput[i] == '~')
 					output += L"      ";
-				if (input[i] == '1')
+				if (lowerInput[i] == '1')
 					output += L"\\___/ ";
-				if (input[i] == '2')
+				if (lowerInput[i] == '2')
 					output += L"\\_____/ ";
-				if (input[i] == '3')
+				if (lowerInput[i] == '3')
 					output += L"\\____/  ";
-				if (input[i] == '4')
+				if (lowerInput[i] == '4')
 					output += L"    |_/ ";
-				if (input[i] == '5')
+				if (lowerInput[i] == '5')
 					output += L"\\____/  ";
-				if (input[i] == '6')
+				if (lowerInput[i] == '6')
 					output += L"\\_____/ ";
-				if (input[i] == '7')
+				if (lowerInput[i] == '7')
 					output += L"\\_/     ";
-				if (input[i] == '.')
+				if (lowerInput[i] == '.')
 					output += L"(_) ";
-				if (input[i] == '8')
+				if (lowerInput[i] == '8')
 					output += L"\\_____/ ";
-				if (input[i] == '9')
+				if (lowerInput[i] == '9')
 					output += L"\\____/  ";
-				if (input[i] == '0')
+				if (lowerInput[i] == '0')
 					output += L" \\___/  ";
-				if (input[i] == '!')
+				if (lowerInput[i] == '!')
 					output += L"(_) ";
-				if (input[i] == '@')
+				if (lowerInput[i] == '@')
 					output += L"  \\____/  ";
-				if (input[i] == '#')
+				if (lowerInput[i] == '#')
 					output += L"  |_||_|   ";
-				if (input[i] == '$')
+				if (lowerInput[i] == '$')
 					output += L" |_|  ";
-				if (input[i] == '%')
+				if (lowerInput[i] == '%')
 					output += L"/_/ (_) ";
-				if (input[i] == '^')
+				if (lowerInput[i] == '^')
 					output += L"     ";
-				if (input[i] == '&')
+				if (lowerInput[i] == '&')
 					output += L" \\___/\\/ ";
-				if (input[i] == '*')
+				if (lowerInput[i] == '*')
 					output += L" \\/|_|\\/  ";
-				if (input[i] == '(')
+				if (lowerInput[i] == '(')
 					output += L" \\_\\ ";
-				if (input[i] == ')')
+				if (lowerInput[i] == ')')
 					output += L"/_/  ";
-				if (input[i] == '-')
+				if (lowerInput[i] == '-')
 					output += L"         ";
-				if (input[i] == '_')
+				if (lowerInput[i] == '_')
 					output += L"|______| ";
-				if (input[i] == '=')
+				if (lowerInput[i] == '=')
 					output += L"         ";
-				if (input[i] == '+')
+				if (lowerInput[i] == '+')
 					output += L"        ";
-				if (input[i] == '[')
+				if (lowerInput[i] == '[')
 					output += L"|___| ";
-				if (input[i] == '{')
+				if (lowerInput[i] == '{')
 					output += L"  \\_\\ ";
-				if (input[i] == ']')
+				if (lowerInput[i] == ']')
 					output += L"|___| ";
-				if (input[i] == '}')
+				if (lowerInput[i] == '}')
 					output += L"/_/   ";
-				if (input[i] == '|')
+				if (lowerInput[i] == '|')
 					output += L"|_| ";
-				if (input[i] == '\\')
+				if (lowerInput[i] == '\\')
 					output += L"    \\_\\ ";
-				if (input[i] == ';')
+				if (lowerInput[i] == ';')
 					output += L"|/  ";
-				if (input[i] == ':')
+				if (lowerInput[i] == ':')
 					output += L"(_) ";
-				if (input[i] == '\'')
+				if (lowerInput[i] == '\'')
 					output += L"    ";
-				if (input[i] == '"')
+				if (lowerInput[i] == '"')
 					output += L"      ";
-				if (input[i] == '<')
+				if (lowerInput[i] == '<')
 					output += L"  \\_\\ ";
-				if (input[i] == ',')
+				if (lowerInput[i] == ',')
 					output += L"|/  ";
-				if (input[i] == '>')
+				if (lowerInput[i] == '>')
 					output += L"/_/   ";
-				if (input[i] == '/')
+				if (lowerInput[i] == '/')
 					output += L"/_/     ";
-				if (input[i] == '?')
+				if (lowerInput[i] == '?')
 					output += L" (_)   ";
 			}
 			output += L"\n";
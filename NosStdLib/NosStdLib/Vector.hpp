@@ -51,7 +51,7 @@ namespace NosStdLib
 			template <typename CharT>
 			std::basic_string<CharT> str()
 			{
-				return NosStdLib::String::ConvertStringTypes<wchar_t, CharT>(std::format(L"({}, {})", this->X, this->Y));
+				return NosStdLib::String::ConvertStringTypes<CharT, wchar_t>(std::format(L"({}, {})", this->X, this->Y));
 			}
 		};
 
@@ -96,7 +96,7 @@ namespace NosStdLib
 			template <typename CharT>
 			std::basic_string<CharT> str()
 			{
-				return NosStdLib::String::ConvertStringTypes<wchar_t, CharT>(std::format(L"({}, {}, {})", this->X, this->Y, this->Z));
+				return NosStdLib::String::ConvertStringTypes<CharT, wchar_t>(std::format(L"({}, {}, {})", this->X, this->Y, this->Z));
 			}
 		};
 	}